@@ -27,11 +27,16 @@
 
 // dconv.
 #include <dconv/atodpow.hpp>
+#include <dconv/config.hpp>
+#include <dconv/bignum.hpp>
+#include <dconv/diyfp.hpp>
 #include <dconv/view.hpp>
 
 // C++.
 #include <limits>
 #include <memory>
+#include <string>
+#include <type_traits>
 
 // C.
 #include <cstring>
@@ -55,17 +60,27 @@ namespace dconv
 
         using LocalePtr = std::unique_ptr <std::remove_pointer_t <locale_t>, LocaleDelete>;
 
-        inline const char * strtodSlow (const char * beg, double& value)
+        inline const char * strtodSlow (const View& view, double& value)
         {
             static LocalePtr locale (newlocale (LC_ALL_MASK, "C", nullptr));
             char* end = nullptr;
-            value = strtod_l (beg, &end, locale.get ());
+            value = strtod_l (view.data (), &end, locale.get ());
             return end;
         }
 
+    #if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+        inline const char * strtodSlow (const View& view, long double& value)
+        {
+            static LocalePtr locale (newlocale (LC_ALL_MASK, "C", nullptr));
+            char* end = nullptr;
+            value = strtold_l (view.data (), &end, locale.get ());
+            return end;
+        }
+    #endif
+
         inline void umul192 (uint64_t hi, uint64_t lo, uint64_t significand, uint64_t& high, uint64_t& middle, uint64_t& low) noexcept
         {
-        #if defined(__SIZEOF_INT128__)
+        #if defined(DCONV_HAS_INT128)
             __uint128_t h = static_cast <__uint128_t> (hi) * significand;
             __uint128_t l = static_cast <__uint128_t> (lo) * significand;
             __uint128_t s = h + (l >> 64);
@@ -74,32 +89,41 @@ namespace dconv
             middle = static_cast <uint64_t> (s);
             low = static_cast <uint64_t> (l);
         #else
-            uint64_t hi_hi, hi_lo, lo_hi, lo_lo;
-
-            uint64_t m_lo = static_cast <uint32_t> (significand);
-            uint64_t m_hi = significand >> 32;
-            uint64_t p0 = (hi & 0xFFFFFFFF) * m_lo;
-            uint64_t p1 = (hi >> 32) * m_lo;
-            uint64_t p2 = (hi & 0xFFFFFFFF) * m_hi;
-            uint64_t p3 = (hi >> 32) * m_hi;
-            uint64_t carry = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
-            hi_lo = (carry << 32) | (p0 & 0xFFFFFFFF);
-            hi_hi = (carry >> 32) + (p1 >> 32) + (p2 >> 32) + p3;
-
-            p0 = (lo & 0xFFFFFFFF) * m_lo;
-            p1 = (lo >> 32) * m_lo;
-            p2 = (lo & 0xFFFFFFFF) * m_hi;
-            p3 = (lo >> 32) * m_hi;
-            carry = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
-            lo_lo = (carry << 32) | (p0 & 0xFFFFFFFF);
-            lo_hi = (carry >> 32) + (p1 >> 32) + (p2 >> 32) + p3;
-
-            low = lo_lo;
-            middle = hi_lo + lo_hi;
-            high = hi_hi + (middle < hi_lo ? 1 : 0);
+            uint64_t carry;
+            low = umul128 (lo, significand, carry);
+            middle = umul128 (hi, significand, high);
+            middle += carry;
+            high += (middle < carry);
         #endif
         }
 
+        /**
+         * @brief round the normalized product of a significand by a power of ten.
+         *
+         * powers are truncated, exact from 10^0 to 10^55 only, so the exact product is above the computed one
+         * by less than two units of the middle word. only a product just below the halfway point can't be decided.
+         * @param exponent decimal exponent of the power.
+         * @param rest bits of the high word below the mantissa.
+         * @param half halfway value of rest.
+         * @param middle middle word of the product.
+         * @param low low word of the product.
+         * @param odd true if the mantissa is odd.
+         * @param roundUp set if the mantissa must be incremented.
+         * @return false if the rounding can't be decided.
+         */
+        inline bool roundProduct (int64_t exponent, uint64_t rest, uint64_t half, uint64_t middle, uint64_t low, bool odd, bool& roundUp) noexcept
+        {
+            const bool exact = (exponent >= 0) && (exponent <= 55);
+
+            if (unlikely ((rest == half - 1) && (middle >= ~static_cast <uint64_t> (1)) && !exact))
+            {
+                return false;
+            }
+
+            roundUp = (rest > half) || ((rest == half) && (middle || low || !exact || odd));
+            return true;
+        }
+
         inline bool strtodFast (bool negative, uint64_t significand, int64_t exponent, double& value) noexcept
         {
             static constexpr double pow10[] = {
@@ -108,24 +132,42 @@ namespace dconv
                 1e22
             };
 
-            value = static_cast <double> (significand);
+            static constexpr uint64_t pow5[] = {
+                1ULL, 5ULL, 25ULL, 125ULL, 625ULL, 3125ULL, 15625ULL, 78125ULL, 390625ULL, 1953125ULL, 9765625ULL,
+                48828125ULL, 244140625ULL, 1220703125ULL, 6103515625ULL, 30517578125ULL, 152587890625ULL,
+                762939453125ULL, 3814697265625ULL, 19073486328125ULL, 95367431640625ULL, 476837158203125ULL,
+                2384185791015625ULL, 11920928955078125ULL, 59604644775390625ULL, 298023223876953125ULL,
+                1490116119384765625ULL, 7450580596923828125ULL
+            };
+
+        #if !defined(__FAST_MATH__)
+            // exact significand and power of ten, the exponent is only moved to the significand
+            // if it stays exact, otherwise the original exponent is used below.
+            double scaled = static_cast <double> (significand);
+            int64_t scaledExponent = exponent;
 
             if (unlikely((exponent > 22) && (exponent < (22 + 16))))
             {
-                value *= pow10[exponent - 22];
-                exponent = 22;
+                scaled *= pow10[exponent - 22];
+                scaledExponent = 22;
             }
 
-            if (likely ((exponent >= -22) && (exponent <= 22) && (value <= 9007199254740991.0)))
+            if (likely ((scaledExponent >= -22) && (scaledExponent <= 22) && (scaled <= 9007199254740991.0)))
             {
-                value = (exponent < 0) ? (value / pow10[-exponent]) : (value * pow10[exponent]);
+                value = (scaledExponent < 0) ? (scaled / pow10[-scaledExponent]) : (scaled * pow10[scaledExponent]);
                 value = negative ? -value : value;
                 return true;
             }
+        #else
+            // the floating point operations above may not be correctly rounded with fast math,
+            // every exponent goes through the integer path.
+            (void) pow10;
+        #endif
 
-            if (unlikely (value == 0.0))
+            if (unlikely (significand == 0))
             {
-                value = negative ? -0.0 : 0.0;
+                const uint64_t bits = static_cast <uint64_t> (negative) << 63;
+                std::memcpy (&value, &bits, sizeof (double));
                 return true;
             }
 
@@ -136,7 +178,23 @@ namespace dconv
 
             uint64_t high, middle, low;
             const Power& power = atodpow[exponent + 325];
+        #if defined(DCONV_HAS_INT128)
             umul192 (power.hi, power.lo, significand, high, middle, low);
+        #else
+            // without native 128-bit products, the low product is only computed when needed: it adds less
+            // than two units to the eleven bits below the mantissa, so it can't change a result that isn't
+            // close to the halfway point.
+            middle = umul128 (power.hi, significand, high);
+            low = 0;
+
+            const int shift = high ? __builtin_clzll (high) : 0;
+            const uint64_t rounding = ((high << shift) | (shift ? (middle >> (64 - shift)) : 0)) & 0x7FF;
+
+            if (unlikely ((high == 0) || (rounding - 0x3FD <= 3)))
+            {
+                umul192 (power.hi, power.lo, significand, high, middle, low);
+            }
+        #endif
             int64_t exp = ((exponent * 217706) >> 16) + 1087;
 
             int lz;
@@ -162,24 +220,34 @@ namespace dconv
 
             if (high == 0)
             {
-                high = middle << lz;
-                middle = 0;
+                high = (middle << lz) | (lz ? (low >> (64 - lz)) : 0);
+                middle = low << lz;
+                low = 0;
             }
             else if (lz != 0)
             {
                 high = (high << lz) | (middle >> (64 - lz));
-                middle <<= lz;
+                middle = (middle << lz) | (low >> (64 - lz));
+                low <<= lz;
             }
 
-            middle |= (low != 0);
-
             uint64_t mant = (high >> 11) & 0xFFFFFFFFFFFFF;
             uint64_t bits = (static_cast <uint64_t> (exp) << 52) | mant;
             uint64_t frac = high & 0x7FF;
 
-            bool roundUp = ((frac >  0x400) |
-                           ((frac == 0x400) && ((middle != 0) || (mant & 1))) |
-                           ((frac == 0x3FF) && ((middle != 0))));
+            bool roundUp;
+
+            if (unlikely (!roundProduct (exponent, frac, 0x400, middle, low, mant & 1, roundUp)))
+            {
+                // decimals that are exact in binary always land here, they are converted exactly.
+                if ((exponent < 0) && (exponent >= -27) && ((significand % pow5[-exponent]) == 0))
+                {
+                    value = std::ldexp (static_cast <double> (significand / pow5[-exponent]), static_cast <int> (exponent));
+                    value = negative ? -value : value;
+                    return true;
+                }
+                return false;
+            }
 
             bits += roundUp;
             bits |= (static_cast <uint64_t> (negative) << 63);
@@ -188,29 +256,465 @@ namespace dconv
             return true;
         }
 
-        inline constexpr bool isDigit (char c) noexcept
+        inline constexpr bool isDigit (int c) noexcept
         {
-            return static_cast <unsigned char> (c - '0') <= 9u;
+            return static_cast <unsigned> (c - '0') <= 9u;
         }
 
-        inline constexpr bool isSign (char c) noexcept
+        inline constexpr bool isSign (int c) noexcept
         {
             return (c == '+') || (c == '-');
         }
 
-        inline const char * atod (View& view, double& value)
+        /**
+         * @brief load 8 characters, the first one in the low byte whatever the byte order.
+         * @param str characters to load.
+         * @return loaded chunk.
+         */
+        inline uint64_t loadChunk (const char* str) noexcept
         {
-            auto beg = view.data ();
+            uint64_t chunk;
+            memcpy (&chunk, str, sizeof (chunk));
+        #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            chunk = __builtin_bswap64 (chunk);
+        #endif
+            return chunk;
+        }
+
+        /**
+         * @brief convert 8 digits at once.
+         * @param chunk digits loaded by loadChunk.
+         * @return converted value.
+         */
+        inline uint64_t parseEightDigits (uint64_t chunk) noexcept
+        {
+            chunk -= 0x3030303030303030ULL;
+            chunk = (chunk * 10) + (chunk >> 8);
+            chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) + (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+            return chunk;
+        }
+
+    #if defined(DCONV_HAS_INT128)
+        inline void umul256 (uint64_t hi, uint64_t lo, __uint128_t significand, __uint128_t& high, __uint128_t& low) noexcept
+        {
+            const __uint128_t M64 = 0xFFFFFFFFFFFFFFFFU;
+
+            __uint128_t s_hi = significand >> 64;
+            __uint128_t s_lo = significand & M64;
+
+            __uint128_t p0 = lo * s_lo;
+            __uint128_t p1 = lo * s_hi;
+            __uint128_t p2 = hi * s_lo;
+            __uint128_t p3 = hi * s_hi;
+
+            __uint128_t mid = (p0 >> 64) + (p1 & M64) + (p2 & M64);
+            low = (mid << 64) | (p0 & M64);
+            high = p3 + (p1 >> 64) + (p2 >> 64) + (mid >> 64);
+        }
+    #endif
+
+        template <typename Float>
+        inline Float assemble (bool negative, WideUInt mant, int64_t binExp, bool sticky) noexcept
+        {
+            using Format = Wide <Float>;
+            constexpr int precision = Format::_mantissaSize;
+            constexpr int bias = Format::_exponentBias - Format::_fractionSize;
+            constexpr int minExponent = 1 - bias;
+
+            int length = static_cast <int> (8 * sizeof (WideUInt)) - clz (mant);
+            int64_t lead = length - 1 + binExp;
+            int64_t drop = length - precision;
+
+            if (lead < minExponent)
+            {
+                drop = (minExponent - precision + 1) - binExp;
+            }
+
+            if (drop > length)
+            {
+                mant = 0;
+            }
+            else if (drop > 0)
+            {
+                bool half = (mant >> (drop - 1)) & 1;
+                sticky |= (mant & ((static_cast <WideUInt> (1) << (drop - 1)) - 1)) != 0;
+                mant >>= drop;
+                mant += half && (sticky || (mant & 1));
+            }
+            else
+            {
+                mant <<= -drop;
+            }
+
+            int64_t exp = binExp + drop + precision - 1 + bias;
+            if (mant >> precision)
+            {
+                mant >>= 1;
+                ++exp;
+            }
+            if (!(mant >> (precision - 1)))
+            {
+                exp = 0;
+            }
+
+            if (exp >= Format::_maxExponent)
+            {
+                return Format::fromBits (negative, Format::_maxExponent, Format::_hiddenBit);
+            }
+
+            return Format::fromBits (negative, static_cast <int> (exp), mant);
+        }
+
+    #if defined(DCONV_HAS_INT128)
+        template <typename Float>
+        inline bool strtodFast (bool negative, __uint128_t significand, int64_t exponent, Float& value) noexcept
+        {
+            using Format = Wide <Float>;
+            constexpr int shift = 128 - Format::_mantissaSize;
+            constexpr __uint128_t mask = (static_cast <__uint128_t> (1) << (shift - 1)) - 1;
+
+            if (unlikely (significand == 0))
+            {
+                value = Format::fromBits (negative, 0, 0);
+                return true;
+            }
+
+            if (unlikely (exponent < -325 || exponent > 308))
+            {
+                return false;
+            }
+
+            __uint128_t high, low;
+            const Power& power = atodpow[exponent + 325];
+            umul256 (power.hi, power.lo, significand, high, low);
+
+            int lz = high ? DiyFp128::clz (high) : 128 + DiyFp128::clz (low);
+            int64_t exp = ((exponent * 217706) >> 16) + 128 - lz + Format::_exponentBias - Format::_fractionSize;
+
+            if (unlikely (exp <= 0 || exp >= Format::_maxExponent))
+            {
+                return false;
+            }
+
+            if (lz >= 128)
+            {
+                high = low << (lz - 128);
+                low = 0;
+            }
+            else if (lz != 0)
+            {
+                high = (high << lz) | (low >> (128 - lz));
+                low <<= lz;
+            }
+
+            __uint128_t mant = high >> shift;
+            __uint128_t frac = high & mask;
+            bool half = (high >> (shift - 1)) & 1;
+            bool roundUp = half;
+
+            if (exponent >= 0 && exponent <= 55)
+            {
+                // power of ten is exact, so is the product.
+                roundUp = half && ((frac != 0) || (low != 0) || (mant & 1));
+            }
+            else if (unlikely (frac >= mask - 2))
+            {
+                // truncated power of ten, the product may be up to 3 units too small.
+                // decimals that are exact in binary always land here, they are handled exactly.
+                if (exponent < 0 && exponent >= -55)
+                {
+                    __uint128_t pow5 = 1;
+                    for (int64_t i = exponent; i < 0; ++i)
+                    {
+                        pow5 *= 5;
+                    }
+                    if ((significand % pow5) == 0)
+                    {
+                        value = assemble <Float> (negative, significand / pow5, exponent, false);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            mant += roundUp;
+            if (unlikely (mant >> Format::_mantissaSize))
+            {
+                mant >>= 1;
+                if (unlikely (++exp >= Format::_maxExponent))
+                {
+                    return false;
+                }
+            }
+
+            value = Format::fromBits (negative, static_cast <int> (exp), mant);
+            return true;
+        }
+
+    #endif
+
+        template <typename Float>
+        inline const char * strtodExact (View view, Float& value)
+        {
+            using Format = Wide <Float>;
+            constexpr int precision = Format::_mantissaSize;
+            constexpr int maxDigits = 12000;
+            static_assert (precision + 3 <= static_cast <int> (8 * sizeof (WideUInt)), "mantissa doesn't fit the exact conversion");
+
+            BigNum num;
+            int64_t exponent = 0;
+            int digits = 0;
+            bool sticky = false;
 
-            uint64_t significand = 0;
-            uint64_t digits = 0;
             bool neg = view.getIf ('-');
+            view.getIf ('+');
+
+            auto accumulate = [&] (int c) {
+                if (digits < maxDigits)
+                {
+                    if (c != '0' || digits)
+                    {
+                        num.multiplyAdd (10, c - '0');
+                        ++digits;
+                    }
+                }
+                else
+                {
+                    sticky |= (c != '0');
+                    ++exponent;
+                }
+            };
+
+            if (unlikely (!isDigit (view.peek ()) && !(view.peek () == '.')))
+            {
+                return nullptr;
+            }
+
+            while (isDigit (view.peek ()))
+            {
+                accumulate (view.get ());
+            }
+
+            if (view.getIf ('.'))
+            {
+                while (isDigit (view.peek ()))
+                {
+                    accumulate (view.get ());
+                    --exponent;
+                }
+            }
+
+            const char * end = view.data ();
+
+            if (view.getIf ('e') || view.getIf ('E'))
+            {
+                bool negExp = false;
+
+                if (isSign (view.peek ()))
+                {
+                    negExp = (view.get () == '-');
+                }
+
+                if (isDigit (view.peek ()))
+                {
+                    int64_t exp = 0;
+
+                    while (isDigit (view.peek ()))
+                    {
+                        int c = view.get ();
+                        if (likely (exp < 100000))
+                        {
+                            exp = (10 * exp) + (c - '0');
+                        }
+                    }
+
+                    exponent += (negExp ? -exp : exp);
+                    end = view.data ();
+                }
+            }
+
+            if (sticky)
+            {
+                // dropped digits are replaced by a single non zero digit.
+                num.multiplyAdd (10, 1);
+                ++digits;
+                --exponent;
+            }
+
+            if (num.isZero () || (digits + exponent < -4967))
+            {
+                value = Format::fromBits (neg, 0, 0);
+                return end;
+            }
+
+            if (digits + exponent > 4934)
+            {
+                value = Format::fromBits (neg, Format::_maxExponent, Format::_hiddenBit);
+                return end;
+            }
+
+            // get at least precision + 2 significant bits, lower bits are kept as a sticky flag.
+            WideUInt mant = 0;
+            int64_t binExp = 0;
+            sticky = false;
+
+            if (exponent >= 0)
+            {
+                num.multiplyPow10 (static_cast <int> (exponent));
+                int length = num.bitLength ();
+                int drop = length > precision + 3 ? length - precision - 3 : 0;
+                // shifted twice, a single shift by 64 is undefined for a 64 bits mantissa.
+                for (int i = static_cast <int> (sizeof (WideUInt) / sizeof (uint64_t)) - 1; i >= 0; --i)
+                {
+                    mant = (mant << 32 << 32) | num.bits (drop + (64 * i));
+                }
+                sticky = num.anyBelow (drop);
+                binExp = drop;
+            }
+            else
+            {
+                BigNum den (1);
+                den.multiplyPow10 (static_cast <int> (-exponent));
+                int scale = den.bitLength () - num.bitLength () + precision + 2;
+                if (scale > 0)
+                {
+                    num.shiftLeft (scale);
+                }
+                else
+                {
+                    den.shiftLeft (-scale);
+                }
+                den.shiftLeft (precision + 2);
+                for (int i = precision + 2; i >= 0; --i, den.halve ())
+                {
+                    if (num.compare (den) >= 0)
+                    {
+                        num.subtract (den);
+                        mant |= static_cast <WideUInt> (1) << i;
+                    }
+                }
+                sticky = !num.isZero ();
+                binExp = -scale;
+            }
+
+            value = assemble <Float> (neg, mant, binExp, sticky);
+            return end;
+        }
+
+    #if defined(DCONV_HAS_FLOAT128)
+        inline const char * strtodSlow (const View& view, __float128& value)
+        {
+            return strtodExact (view, value);
+        }
+    #endif
+
+        template <typename CharT, typename Float>
+        inline const CharT * strtodSlow (const BasicView <CharT>& view, Float& value)
+        {
+            // the number is ASCII only, its code units are narrowed up to the first one that can't be part of it.
+            std::string narrow;
+            const CharT* pos = view.data ();
+            const CharT* end = pos + view.size ();
+
+            while ((pos < end) && (isDigit (*pos) || isSign (*pos) || (*pos == '.') || (*pos == 'e') || (*pos == 'E')))
+            {
+                narrow += static_cast <char> (*pos++);
+            }
+
+            const char* last = strtodSlow (View (narrow.c_str (), narrow.size ()), value);
+
+            return last ? view.data () + (last - narrow.c_str ()) : nullptr;
+        }
+
+        /**
+         * @brief floating point types supported by the wide character overloads.
+         */
+        template <typename Float>
+        struct IsParsable : std::is_same <Float, double>
+        {
+        };
+
+    #if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+        template <>
+        struct IsParsable <long double> : std::true_type
+        {
+        };
+    #endif
+
+    #if defined(DCONV_HAS_FLOAT128)
+        template <>
+        struct IsParsable <__float128> : std::true_type
+        {
+        };
+    #endif
+
+        template <typename Float>
+        struct SignificandTraits
+        {
+            using Type = uint64_t;
+        };
+
+    #if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+        template <>
+        struct SignificandTraits <long double>
+        {
+            using Type = __uint128_t;
+        };
+    #endif
+
+    #if defined(DCONV_HAS_FLOAT128)
+        template <>
+        struct SignificandTraits <__float128>
+        {
+            using Type = __uint128_t;
+        };
+    #endif
+
+        /**
+         * @brief token accumulated by accumulate.
+         */
+        enum class Token
+        {
+            Invalid,    /**< grammar error. */
+            Integer,    /**< finite number without fractional part nor exponent. */
+            Number,     /**< finite number. */
+            Infinity,   /**< infinity. */
+            NaN,        /**< not a number. */
+        };
+
+        /**
+         * @brief check if token is a finite number.
+         * @param token token to check.
+         * @return true if finite number.
+         */
+        constexpr bool isFinite (Token token) noexcept
+        {
+            return (token == Token::Integer) || (token == Token::Number);
+        }
+
+        /**
+         * @brief accumulate the significant digits of a number.
+         *
+         * only the leading digits that fit in the significand are kept, the dropped ones
+         * are accounted in the exponent and truncated is set if any of them is not zero.
+         * Token::Integer is returned when neither a fractional part nor an exponent is present.
+         */
+        template <typename Significand, typename CharT>
+        inline Token accumulate (BasicView <CharT>& view, bool& neg, Significand& significand, int64_t& exponent, bool& truncated) noexcept
+        {
+            constexpr uint64_t maxDigits = (sizeof (Significand) == sizeof (uint64_t)) ? 19 : 38;
+            uint64_t digits = 0;
+
+            significand = 0;
+            exponent = 0;
+            truncated = false;
+            neg = view.getIf ('-');
 
             if (view.getIf ('0'))
             {
                 if (unlikely (isDigit (view.peek ())))
                 {
-                    return nullptr;
+                    return Token::Invalid;
                 }
             }
             else if (likely (isDigit (view.peek ())))
@@ -220,13 +724,17 @@ namespace dconv
 
                 while (isDigit (view.peek ()))
                 {
-                    uint64_t next = (10 * significand) + (view.get () - '0');
-                    if (unlikely (next < significand)) // overflow
+                    const int d = view.get () - '0';
+                    if (likely (digits < maxDigits))
+                    {
+                        significand = (10 * significand) + d;
+                        ++digits;
+                    }
+                    else
                     {
-                        return strtodSlow (beg, value);
+                        truncated |= (d != 0);
+                        ++exponent;
                     }
-                    significand = next;
-                    ++digits;
                 }
             }
             else if (view.getIfNoCase ('i') && view.getIfNoCase ('n') && view.getIfNoCase ('f'))
@@ -236,46 +744,46 @@ namespace dconv
                     if (!(view.getIfNoCase ('n') && view.getIfNoCase ('i') && 
                           view.getIfNoCase ('t') && view.getIfNoCase ('y')))
                     {
-                        return nullptr;
+                        return Token::Invalid;
                     }
                 }
-                value = neg ? -std::numeric_limits <double>::infinity () : std::numeric_limits <double>::infinity ();
-                return view.data ();
+                return Token::Infinity;
             }
             else if (view.getIfNoCase ('n') && view.getIfNoCase ('a') && view.getIfNoCase ('n'))
             {
-                value = neg ? -std::numeric_limits <double>::quiet_NaN () : std::numeric_limits <double>::quiet_NaN ();
-                return view.data ();
+                return Token::NaN;
             }
             else
             {
-                return nullptr;
+                return Token::Invalid;
             }
 
-            int64_t exponent = 0;
+            Token token = Token::Integer;
 
             if (view.getIf ('.'))
             {
                 if (unlikely (!isDigit (view.peek ())))
                 {
-                    return nullptr;
+                    return Token::Invalid;
                 }
 
-                significand = (10 * significand) + (view.get () - '0');
-                if (significand || digits) ++digits;
-                --exponent;
+                token = Token::Number;
 
-                while (isDigit (view.peek ()))
+                do
                 {
-                    uint64_t next = (10 * significand) + (view.get () - '0');
-                    if (unlikely (next < significand)) // overflow
+                    const int d = view.get () - '0';
+                    if (likely (digits < maxDigits))
                     {
-                        return strtodSlow (beg, value);
+                        significand = (10 * significand) + d;
+                        if (significand || digits) ++digits;
+                        --exponent;
+                    }
+                    else
+                    {
+                        truncated |= (d != 0);
                     }
-                    significand = next;
-                    if (significand || digits) ++digits;
-                    --exponent;
                 }
+                while (isDigit (view.peek ()));
             }
 
             if (view.getIf ('e') || view.getIf ('E'))
@@ -289,7 +797,7 @@ namespace dconv
 
                 if (unlikely (!isDigit (view.peek ())))
                 {
-                    return nullptr;
+                    return Token::Invalid;
                 }
 
                 int64_t exp = view.get () - '0';
@@ -307,14 +815,62 @@ namespace dconv
                 }
 
                 exponent += (negExp ? -exp : exp);
+                token = Token::Number;
             }
 
-            if (likely (digits <= 19))
+            return token;
+        }
+
+        /**
+         * @brief fast path conversion of a possibly truncated significand.
+         *
+         * dropped non zero digits put the value strictly between significand and significand + 1,
+         * both bounds are converted and the result is only accepted if they agree.
+         */
+        template <typename Significand, typename Float>
+        inline bool strtodFast (bool negative, Significand significand, int64_t exponent, bool truncated, Float& value) noexcept
+        {
+            if (likely (!truncated))
             {
-                if (strtodFast (neg, significand, exponent, value))
-                {
+                return strtodFast (negative, significand, exponent, value);
+            }
+
+            Float upper;
+
+            return strtodFast (negative, significand, exponent, value) &&
+                   strtodFast (negative, significand + 1, exponent, upper) &&
+                   (value == upper);
+        }
+
+        template <typename Float, typename CharT>
+        inline const CharT * atod (BasicView <CharT>& view, Float& value)
+        {
+            using Significand = typename SignificandTraits <Float>::Type;
+            const BasicView <CharT> beg (view);
+
+            Significand significand;
+            int64_t exponent;
+            bool truncated;
+            bool neg;
+
+            switch (accumulate (view, neg, significand, exponent, truncated))
+            {
+                case Token::Integer:
+                case Token::Number:
+                    break;
+                case Token::Infinity:
+                    value = static_cast <Float> (neg ? -std::numeric_limits <double>::infinity () : std::numeric_limits <double>::infinity ());
                     return view.data ();
-                }
+                case Token::NaN:
+                    value = static_cast <Float> (neg ? -std::numeric_limits <double>::quiet_NaN () : std::numeric_limits <double>::quiet_NaN ());
+                    return view.data ();
+                default:
+                    return nullptr;
+            }
+
+            if (likely (strtodFast (neg, significand, exponent, truncated, value)))
+            {
+                return view.data ();
             }
 
             return strtodSlow (beg, value);
@@ -327,11 +883,15 @@ namespace dconv
      * @param value converted value.
      * @return end position on success, nullptr on failure.
      */
-    inline const char* atod (const char* str, double& value)
+    DCONV_API const char* atod (const char* str, double& value)
+#if defined(DCONV_DECLARE_ONLY)
+    ;
+#else
     {
         View view (str);
         return details::atod (view, value);
     }
+#endif
 
     /**
      * @brief string to double conversion.
@@ -340,11 +900,15 @@ namespace dconv
      * @param value converted value.
      * @return end position on success, nullptr on failure.
      */
-    inline const char* atod (const char* str, size_t length, double& value)
+    DCONV_API const char* atod (const char* str, size_t length, double& value)
+#if defined(DCONV_DECLARE_ONLY)
+    ;
+#else
     {
         View view (str, length);
         return details::atod (view, value);
     }
+#endif
 
     /**
      * @brief string to double conversion.
@@ -353,11 +917,187 @@ namespace dconv
      * @param value converted value.
      * @return end position on success, nullptr on failure.
      */
-    inline const char* atod (const char* first, const char* last, double& value)
+    DCONV_API const char* atod (const char* first, const char* last, double& value)
+#if defined(DCONV_DECLARE_ONLY)
+    ;
+#else
+    {
+        View view (first, last);
+        return details::atod (view, value);
+    }
+#endif
+
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+    /**
+     * @brief string to long double conversion.
+     * @param str string to parse.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* str, long double& value)
+    {
+        View view (str);
+        return details::atod (view, value);
+    }
+
+    /**
+     * @brief string to long double conversion.
+     * @param str string to parse.
+     * @param length string length.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* str, size_t length, long double& value)
+    {
+        View view (str, length);
+        return details::atod (view, value);
+    }
+
+    /**
+     * @brief string to long double conversion.
+     * @param first string first position.
+     * @param last string last position.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* first, const char* last, long double& value)
     {
         View view (first, last);
         return details::atod (view, value);
     }
+#elif (LDBL_MANT_DIG == 53)
+    /**
+     * @brief string to long double conversion.
+     * @param str string to parse.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* str, long double& value)
+    {
+        double tmp = 0.0;
+        const char* end = atod (str, tmp);
+        value = tmp;
+        return end;
+    }
+
+    /**
+     * @brief string to long double conversion.
+     * @param str string to parse.
+     * @param length string length.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* str, size_t length, long double& value)
+    {
+        double tmp = 0.0;
+        const char* end = atod (str, length, tmp);
+        value = tmp;
+        return end;
+    }
+
+    /**
+     * @brief string to long double conversion.
+     * @param first string first position.
+     * @param last string last position.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* first, const char* last, long double& value)
+    {
+        double tmp = 0.0;
+        const char* end = atod (first, last, tmp);
+        value = tmp;
+        return end;
+    }
+#else
+    const char* atod (const char* str, long double& value) = delete;
+    const char* atod (const char* str, size_t length, long double& value) = delete;
+    const char* atod (const char* first, const char* last, long double& value) = delete;
+#endif
+
+#if defined(DCONV_HAS_FLOAT128)
+    /**
+     * @brief string to __float128 conversion.
+     * @param str string to parse.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* str, __float128& value)
+    {
+        View view (str);
+        return details::atod (view, value);
+    }
+
+    /**
+     * @brief string to __float128 conversion.
+     * @param str string to parse.
+     * @param length string length.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* str, size_t length, __float128& value)
+    {
+        View view (str, length);
+        return details::atod (view, value);
+    }
+
+    /**
+     * @brief string to __float128 conversion.
+     * @param first string first position.
+     * @param last string last position.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* atod (const char* first, const char* last, __float128& value)
+    {
+        View view (first, last);
+        return details::atod (view, value);
+    }
+#endif
+
+    /**
+     * @brief wide string to floating point conversion.
+     * @param str string to parse.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    template <typename CharT, typename Float, typename = EnableIfWideChar <CharT>,
+              typename = std::enable_if_t <details::IsParsable <Float>::value>>
+    inline const CharT* atod (const CharT* str, Float& value)
+    {
+        BasicView <CharT> view (str);
+        return details::atod (view, value);
+    }
+
+    /**
+     * @brief wide string to floating point conversion.
+     * @param str string to parse.
+     * @param length string length.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    template <typename CharT, typename Float, typename = EnableIfWideChar <CharT>,
+              typename = std::enable_if_t <details::IsParsable <Float>::value>>
+    inline const CharT* atod (const CharT* str, size_t length, Float& value)
+    {
+        BasicView <CharT> view (str, length);
+        return details::atod (view, value);
+    }
+
+    /**
+     * @brief wide string to floating point conversion.
+     * @param first string first position.
+     * @param last string last position.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    template <typename CharT, typename Float, typename = EnableIfWideChar <CharT>,
+              typename = std::enable_if_t <details::IsParsable <Float>::value>>
+    inline const CharT* atod (const CharT* first, const CharT* last, Float& value)
+    {
+        BasicView <CharT> view (first, last);
+        return details::atod (view, value);
+    }
 }
 
 #endif
@@ -25,6 +25,10 @@
 #ifndef __DCONV_ATODPOW_HPP__
 #define __DCONV_ATODPOW_HPP__
 
+// dconv.
+#include <dconv/config.hpp>
+
+// C.
 #include <cstdint>
 
 namespace dconv
@@ -37,7 +41,10 @@ namespace dconv
             uint64_t lo;
         };
 
-        constexpr Power atodpow[] = {
+    #if defined(DCONV_DECLARE_ONLY)
+        extern const Power atodpow[634];
+    #else
+        DCONV_TABLE Power atodpow[] = {
             {0xa5ced43b7e3e9188, 0x419ea3bd35385e2d},
             {0xcf42894a5dce35ea, 0x52064cac828675b9},
             {0x818995ce7aa0e1b2, 0x7343efebd1940993},
@@ -673,6 +680,7 @@ namespace dconv
             {0xe3d8f9e563a198e5, 0x58180fddd97723a6},
             {0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648},
         };
+    #endif
     }
 }
 
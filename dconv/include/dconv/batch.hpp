@@ -0,0 +1,277 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_BATCH_HPP__
+#define __DCONV_BATCH_HPP__
+
+// dconv.
+#include <dconv/dispatch.hpp>
+#include <dconv/dtoa.hpp>
+
+// C.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(DCONV_HAS_DISPATCH)
+#define DCONV_HAS_BATCH_SIMD
+#endif
+
+namespace dconv
+{
+    namespace details
+    {
+        /**
+         * @brief batch kernel lanes (256 bits).
+         */
+        typedef uint64_t BatchVector4 __attribute__ ((vector_size (4 * sizeof (uint64_t))));
+
+        /**
+         * @brief batch kernel lanes (512 bits).
+         */
+        typedef uint64_t BatchVector8 __attribute__ ((vector_size (8 * sizeof (uint64_t))));
+
+        /**
+         * @brief batch conversion function.
+         */
+        using BatchFunction = char* (*) (char*, const double*, size_t, char);
+
+        inline char* dtoaBatchScalar (char* buffer, const double* first, size_t count, char separator)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (i)
+                {
+                    *buffer++ = separator;
+                }
+                buffer = dconv::dtoa (buffer, first[i]);
+            }
+            return buffer;
+        }
+
+        template <typename Vector>
+        inline __attribute__ ((always_inline)) char* dtoaBatchLanes (char* buffer, const double* first, size_t count, char separator)
+        {
+            constexpr size_t Lanes = sizeof (Vector) / sizeof (uint64_t);
+
+            static const uint64_t kPow10[] = {
+                1ULL,                 10ULL,                 100ULL,                 1000ULL,
+                10000ULL,             100000ULL,             1000000ULL,             10000000ULL,
+                100000000ULL,         1000000000ULL,         10000000000ULL,         100000000000ULL,
+                1000000000000ULL,     10000000000000ULL,     100000000000000ULL,     1000000000000000ULL,
+                10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+            };
+
+            for (size_t base = 0; base < count; base += Lanes)
+            {
+                const size_t lanes = (count - base < Lanes) ? count - base : Lanes;
+
+                // 0 = scalar fallback, 1 = done, 2 = fractional digits pending.
+                uint8_t state[Lanes] = {};
+                bool negative[Lanes] = {};
+                char digits[Lanes][48];
+                int length[Lanes] = {}, k[Lanes] = {};
+                uint64_t wp_w[Lanes] = {};
+                Vector p2 = {}, delta, shift = {}, mask = {}, running = {};
+
+                for (size_t lane = 0; lane < Lanes; ++lane)
+                {
+                    delta[lane] = 1;
+                }
+
+                // boundaries, cached power and integral digits, one lane at a time.
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    uint64_t bits;
+                    memcpy (&bits, &first[base + lane], sizeof (double));
+                    negative[lane] = (bits >> 63) != 0;
+                    bits &= ~(static_cast <uint64_t> (1) << 63);
+
+                    if ((bits == 0) || ((bits >> 52) == 0x7FF))
+                    {
+                        continue;
+                    }
+
+                    double value;
+                    memcpy (&value, &bits, sizeof (double));
+
+                    DiyFp val (value), minus, plus;
+                    val.normalizedBoundaries (minus, plus);
+
+                    int mk = kComputation (plus._exponent + 64, -59);
+                    const DiyFp& c_mk = dtoapow[mk + 343];
+
+                    minus *= c_mk;
+                    plus  *= c_mk;
+
+                    ++minus._mantissa;
+                    --plus._mantissa;
+
+                    k[lane] = -mk;
+
+                    DiyFp W = val.normalize () * c_mk;
+                    uint64_t dlt = plus._mantissa - minus._mantissa;
+
+                    if (digitsGenIntegral (W, plus, dlt, digits[lane], length[lane], k[lane]))
+                    {
+                        state[lane] = 1;
+                        continue;
+                    }
+
+                    state[lane]   = 2;
+                    wp_w[lane]    = (plus - W)._mantissa;
+                    shift[lane]   = -plus._exponent;
+                    mask[lane]    = (static_cast <uint64_t> (1) << -plus._exponent) - 1;
+                    p2[lane]      = plus._mantissa & mask[lane];
+                    delta[lane]   = dlt;
+                    running[lane] = ~static_cast <uint64_t> (0);
+                }
+
+                // fractional digits, all lanes at once, packed 8 per word.
+                Vector packed[3] = {}, rest = {}, restDelta = {}, iterations = {};
+
+                for (uint64_t i = 1; i < 20; ++i)
+                {
+                    p2    = (p2 << 3) + (p2 << 1);
+                    delta = (delta << 3) + (delta << 1);
+
+                    packed[(i - 1) / 8] |= (p2 >> shift) << (8 * ((i - 1) % 8));
+
+                    p2 &= mask;
+
+                    Vector stop = running & reinterpret_cast <Vector> (p2 < delta);
+                    rest        = (rest & ~stop) | (p2 & stop);
+                    restDelta   = (restDelta & ~stop) | (delta & stop);
+                    iterations  = (iterations & ~stop) | (i & stop);
+                    running    &= ~stop;
+
+                    uint64_t any = 0;
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        any |= running[lane];
+                    }
+                    if (!any)
+                    {
+                        break;
+                    }
+                }
+
+                // rounding and layout, one lane at a time.
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    if (base + lane)
+                    {
+                        *buffer++ = separator;
+                    }
+
+                    if (state[lane] == 0)
+                    {
+                        buffer = dconv::dtoa (buffer, first[base + lane]);
+                        continue;
+                    }
+
+                    if (state[lane] == 2)
+                    {
+                        const int n = static_cast <int> (iterations[lane]);
+                        const uint64_t words[3] = {
+                            packed[0][lane] | 0x3030303030303030ULL,
+                            packed[1][lane] | 0x3030303030303030ULL,
+                            packed[2][lane] | 0x3030303030303030ULL,
+                        };
+                        memcpy (digits[lane] + length[lane], words, sizeof (words));
+                        length[lane] += n;
+                        k[lane] -= n;
+                        grisuRound (digits[lane], length[lane], restDelta[lane], rest[lane], mask[lane] + 1, wp_w[lane] * kPow10[n]);
+                    }
+
+                    *buffer = '-';
+                    buffer += negative[lane];
+                    buffer = place (buffer, digits[lane], length[lane], k[lane]);
+                }
+            }
+
+            return buffer;
+        }
+
+    #if defined(DCONV_HAS_BATCH_SIMD)
+        __attribute__ ((target ("avx512f")))
+        inline char* dtoaBatchAvx512 (char* buffer, const double* first, size_t count, char separator)
+        {
+            return dtoaBatchLanes <BatchVector8> (buffer, first, count, separator);
+        }
+
+        __attribute__ ((target ("avx2")))
+        inline char* dtoaBatchAvx2 (char* buffer, const double* first, size_t count, char separator)
+        {
+            return dtoaBatchLanes <BatchVector4> (buffer, first, count, separator);
+        }
+    #endif
+
+        /**
+         * @brief batch dtoa kernel selection.
+         */
+        struct BatchKernel
+        {
+            using Function = BatchFunction;
+
+            /**
+             * @brief select the batch dtoa implementation.
+             * @param tier SIMD tier.
+             * @return batch dtoa implementation.
+             */
+            static Function select (SimdTier tier) noexcept
+            {
+            #if defined(DCONV_HAS_BATCH_SIMD)
+                switch (tier)
+                {
+                    case SimdAvx512:
+                        return dtoaBatchAvx512;
+                    case SimdAvx2:
+                        return dtoaBatchAvx2;
+                    default:
+                        break;
+                }
+            #else
+                (void) tier;
+            #endif
+                return dtoaBatchScalar;
+            }
+        };
+    }
+
+    /**
+     * @brief convert a sequence of doubles to strings.
+     * @param buffer buffer to write the string representations to (at least 26 characters per value).
+     * @param first first value to convert.
+     * @param last end of the values to convert.
+     * @param separator character written between two values.
+     * @return end position.
+     */
+    inline char* dtoa (char* buffer, const double* first, const double* last, char separator = ',')
+    {
+        return details::Dispatch <details::BatchKernel>::call (buffer, first, static_cast <size_t> (last - first), separator);
+    }
+}
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_BIGNUM_HPP__
+#define __DCONV_BIGNUM_HPP__
+
+// C++.
+#include <vector>
+
+// C.
+#include <cstdint>
+#include <cstddef>
+
+namespace dconv
+{
+    namespace details
+    {
+        /**
+         * @brief arbitrary precision unsigned integer.
+         */
+        class BigNum
+        {
+        public:
+            /**
+             * @brief create big number using an unsigned integer.
+             * @param value initial value.
+             */
+            explicit BigNum (uint64_t value = 0)
+            {
+                _data.push_back (static_cast <uint32_t> (value));
+                if (value >> 32)
+                {
+                    _data.push_back (static_cast <uint32_t> (value >> 32));
+                }
+            }
+
+            /**
+             * @brief multiply by factor and add addend.
+             * @param factor factor.
+             * @param addend addend.
+             * @return a reference of the current object.
+             */
+            BigNum& multiplyAdd (uint32_t factor, uint32_t addend = 0)
+            {
+                uint64_t carry = addend;
+                for (auto& limb : _data)
+                {
+                    uint64_t product = (static_cast <uint64_t> (limb) * factor) + carry;
+                    limb = static_cast <uint32_t> (product);
+                    carry = product >> 32;
+                }
+                if (carry)
+                {
+                    _data.push_back (static_cast <uint32_t> (carry));
+                }
+                return *this;
+            }
+
+            /**
+             * @brief multiply by a power of ten.
+             * @param exponent positive exponent.
+             * @return a reference of the current object.
+             */
+            BigNum& multiplyPow10 (int exponent)
+            {
+                for (; exponent >= 9; exponent -= 9)
+                {
+                    multiplyAdd (1000000000);
+                }
+                static const uint32_t pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+                return multiplyAdd (pow10[exponent]);
+            }
+
+            /**
+             * @brief shift left.
+             * @param shift shift count.
+             * @return a reference of the current object.
+             */
+            BigNum& shiftLeft (int shift)
+            {
+                size_t words = shift / 32;
+                int bits = shift % 32;
+
+                if (bits)
+                {
+                    uint32_t carry = 0;
+                    for (auto& limb : _data)
+                    {
+                        uint32_t next = limb >> (32 - bits);
+                        limb = (limb << bits) | carry;
+                        carry = next;
+                    }
+                    if (carry)
+                    {
+                        _data.push_back (carry);
+                    }
+                }
+
+                _data.insert (_data.begin (), words, 0);
+                return *this;
+            }
+
+            /**
+             * @brief shift right by one bit.
+             * @return a reference of the current object.
+             */
+            BigNum& halve () noexcept
+            {
+                uint32_t carry = 0;
+                for (size_t i = _data.size (); i-- > 0;)
+                {
+                    uint32_t next = _data[i] << 31;
+                    _data[i] = (_data[i] >> 1) | carry;
+                    carry = next;
+                }
+                trim ();
+                return *this;
+            }
+
+            /**
+             * @brief subtract a lower or equal big number.
+             * @param other big number to subtract.
+             * @return a reference of the current object.
+             */
+            BigNum& subtract (const BigNum& other) noexcept
+            {
+                int64_t borrow = 0;
+                for (size_t i = 0; i < _data.size (); ++i)
+                {
+                    int64_t diff = static_cast <int64_t> (_data[i]) - borrow - (i < other._data.size () ? other._data[i] : 0);
+                    borrow = diff < 0;
+                    _data[i] = static_cast <uint32_t> (diff);
+                }
+                trim ();
+                return *this;
+            }
+
+            /**
+             * @brief compare with another big number.
+             * @param other big number to compare with.
+             * @return a negative value if lower, zero if equal, a positive value if greater.
+             */
+            int compare (const BigNum& other) const noexcept
+            {
+                if (_data.size () != other._data.size ())
+                {
+                    return (_data.size () < other._data.size ()) ? -1 : 1;
+                }
+                for (size_t i = _data.size (); i-- > 0;)
+                {
+                    if (_data[i] != other._data[i])
+                    {
+                        return (_data[i] < other._data[i]) ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
+            /**
+             * @brief check if the big number is zero.
+             * @return true if zero, false otherwise.
+             */
+            bool isZero () const noexcept
+            {
+                return (_data.size () == 1) && (_data[0] == 0);
+            }
+
+            /**
+             * @brief get number of significant bits.
+             * @return number of significant bits.
+             */
+            int bitLength () const noexcept
+            {
+                uint32_t msb = _data.back ();
+                return static_cast <int> (_data.size () - 1) * 32 + (msb ? 32 - __builtin_clz (msb) : 0);
+            }
+
+            /**
+             * @brief get bits [pos, pos + 64).
+             * @param pos position of the lowest bit.
+             * @return extracted bits.
+             */
+            uint64_t bits (int pos) const noexcept
+            {
+                uint64_t result = 0;
+                for (int i = 0; i < 64; i += 32)
+                {
+                    result |= static_cast <uint64_t> (word (pos + i)) << i;
+                }
+                return result;
+            }
+
+            /**
+             * @brief check if any bit below pos is set.
+             * @param pos bit position.
+             * @return true if any bit below pos is set.
+             */
+            bool anyBelow (int pos) const noexcept
+            {
+                size_t words = pos / 32;
+                for (size_t i = 0; i < words && i < _data.size (); ++i)
+                {
+                    if (_data[i])
+                    {
+                        return true;
+                    }
+                }
+                return (pos % 32) && (words < _data.size ()) && (_data[words] << (32 - (pos % 32)));
+            }
+
+        private:
+            /**
+             * @brief get 32 bits starting at pos.
+             * @param pos position of the lowest bit.
+             * @return extracted bits.
+             */
+            uint32_t word (int pos) const noexcept
+            {
+                size_t index = pos / 32;
+                int shift = pos % 32;
+                uint64_t lo = (index < _data.size ()) ? _data[index] : 0;
+                uint64_t hi = (index + 1 < _data.size ()) ? _data[index + 1] : 0;
+                return static_cast <uint32_t> (((hi << 32) | lo) >> shift);
+            }
+
+            /**
+             * @brief remove most significant zero limbs.
+             */
+            void trim () noexcept
+            {
+                while (_data.size () > 1 && _data.back () == 0)
+                {
+                    _data.pop_back ();
+                }
+            }
+
+            /// limbs (least significant first).
+            std::vector <uint32_t> _data;
+        };
+    }
+}
+
+#endif
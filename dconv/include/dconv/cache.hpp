@@ -0,0 +1,346 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_CACHE_HPP__
+#define __DCONV_CACHE_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+// C.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dconv
+{
+    namespace details
+    {
+        /**
+         * @brief get the slot of a 64 bits key.
+         * @param key key.
+         * @param bits number of bits of the slot.
+         * @return slot.
+         */
+        inline size_t cacheSlot (uint64_t key, size_t bits) noexcept
+        {
+            return static_cast <size_t> ((key * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+        }
+
+        inline constexpr bool isNumberChar (char c) noexcept
+        {
+            return ((c >= '0') && (c <= '9')) || (c == '.') || (c == '-') || (c == '+') || ((c | 32) == 'e');
+        }
+
+        /**
+         * @brief get the leading run of number characters of a string.
+         * @param first pointer to the first character of the string.
+         * @param last pointer to the last character of the string.
+         * @param key run characters, zero padded.
+         * @return run length, 32 if the run is too long to be a key.
+         */
+        inline size_t numberKey (const char* first, const char* last, char (&key)[32]) noexcept
+        {
+        #if defined(__SSE2__)
+            if (likely (last - first >= 32))
+            {
+                const __m128i c0 = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (first));
+                const __m128i c1 = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (first + 16));
+
+                const auto mask = [] (__m128i c) {
+                    const __m128i digit = _mm_and_si128 (_mm_cmpgt_epi8 (c, _mm_set1_epi8 ('0' - 1)), _mm_cmplt_epi8 (c, _mm_set1_epi8 ('9' + 1)));
+                    const __m128i punct = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('.')), _mm_cmpeq_epi8 (c, _mm_set1_epi8 ('-'))),
+                                                        _mm_or_si128 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('+')), _mm_cmpeq_epi8 (_mm_or_si128 (c, _mm_set1_epi8 (32)), _mm_set1_epi8 ('e'))));
+                    return static_cast <uint32_t> (_mm_movemask_epi8 (_mm_or_si128 (digit, punct)));
+                };
+
+                const uint32_t other = ~(mask (c0) | (mask (c1) << 16));
+                const size_t length = other ? __builtin_ctz (other) : 32;
+                const __m128i len = _mm_set1_epi8 (static_cast <char> (length));
+
+                _mm_storeu_si128 (reinterpret_cast <__m128i*> (key), _mm_and_si128 (c0, _mm_cmpgt_epi8 (len, _mm_setr_epi8 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))));
+                _mm_storeu_si128 (reinterpret_cast <__m128i*> (key + 16), _mm_and_si128 (c1, _mm_cmpgt_epi8 (len, _mm_setr_epi8 (16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31))));
+
+                return length;
+            }
+        #endif
+
+            size_t length = 0;
+
+            memset (key, 0, sizeof (key));
+
+            while ((first < last) && (length < sizeof (key)) && isNumberChar (*first))
+            {
+                key[length++] = *first++;
+            }
+
+            return length;
+        }
+
+        /**
+         * @brief get the 64 bits key of a number.
+         * @param key number characters, zero padded.
+         * @return key.
+         */
+        inline uint64_t numberHash (const char (&key)[32]) noexcept
+        {
+            uint64_t words[4];
+            memcpy (words, key, sizeof (words));
+
+            return (words[0] * 0xC2B2AE3D27D4EB4FULL) ^ (words[1] * 0x165667B19E3779F9ULL) ^ (words[2] * 0x27D4EB2F165667C5ULL) ^ words[3];
+        }
+
+        /**
+         * @brief get the number of bits of a cache slot.
+         * @param n number of slots (power of 2).
+         * @return number of bits.
+         */
+        constexpr size_t cacheBits (size_t n) noexcept
+        {
+            return (n > 1) ? 1 + cacheBits (n >> 1) : 0;
+        }
+    }
+
+    /**
+     * @brief two way set associative cache of double to string conversions.
+     *
+     * a repeated value costs one probe and a copy of its string representation.
+     * the cache is not thread safe, use an instance per thread (i.e. thread_local).
+     */
+    template <size_t Size = 1024>
+    class DtoaCache
+    {
+        static_assert ((Size > 1) && ((Size & (Size - 1)) == 0), "cache size must be a power of 2");
+
+    public:
+        /**
+         * @brief double to string conversion.
+         * @param buffer buffer to write the string representation to (at least 25 characters).
+         * @param value value to convert.
+         * @return end position.
+         */
+        char* dtoa (char* buffer, double value) noexcept
+        {
+            uint64_t bits;
+            memcpy (&bits, &value, sizeof (double));
+
+            Entry* set = &_entries[details::cacheSlot (bits, details::cacheBits (Size)) & ~static_cast <size_t> (1)];
+
+            for (size_t way = 0; way < 2; ++way)
+            {
+                if (likely (set[way]._length && (set[way]._bits == bits)))
+                {
+                    ++_hits;
+                    memcpy (buffer, set[way]._str, sizeof (set[way]._str));
+                    return buffer + set[way]._length;
+                }
+            }
+
+            // the most recent entry goes first, the oldest is evicted.
+            ++_misses;
+            set[1] = set[0];
+            char* end = dconv::dtoa (set[0]._str, value);
+            set[0]._length = static_cast <uint8_t> (end - set[0]._str);
+            set[0]._bits = bits;
+            memcpy (buffer, set[0]._str, set[0]._length);
+
+            return buffer + set[0]._length;
+        }
+
+        /**
+         * @brief get the number of conversions found in cache.
+         * @return number of hits.
+         */
+        size_t hits () const noexcept
+        {
+            return _hits;
+        }
+
+        /**
+         * @brief get the number of conversions not found in cache.
+         * @return number of misses.
+         */
+        size_t misses () const noexcept
+        {
+            return _misses;
+        }
+
+        /**
+         * @brief remove all entries and reset counters.
+         */
+        void clear () noexcept
+        {
+            for (Entry& entry : _entries)
+            {
+                entry._length = 0;
+            }
+            _hits = _misses = 0;
+        }
+
+    private:
+        /**
+         * @brief cache entry.
+         */
+        struct Entry
+        {
+            uint64_t _bits = 0;         /**< value bit pattern. */
+            uint8_t _length = 0;        /**< string length, 0 if empty. */
+            char _str[25];              /**< string representation. */
+        };
+
+        /// cache entries.
+        Entry _entries[Size];
+
+        /// number of hits.
+        size_t _hits = 0;
+
+        /// number of misses.
+        size_t _misses = 0;
+    };
+
+    /**
+     * @brief two way set associative cache of string to double conversions.
+     *
+     * numbers of at most 31 characters are cached by their bytes, longer ones are always converted.
+     * the cache is not thread safe, use an instance per thread (i.e. thread_local).
+     */
+    template <size_t Size = 1024>
+    class AtodCache
+    {
+        static_assert ((Size > 1) && ((Size & (Size - 1)) == 0), "cache size must be a power of 2");
+
+    public:
+        /**
+         * @brief string to double conversion.
+         * @param first pointer to the first character of the string.
+         * @param last pointer to the last character of the string.
+         * @param value converted value.
+         * @return end position on success, nullptr on failure.
+         */
+        const char* atod (const char* first, const char* last, double& value)
+        {
+            alignas (16) char key[32];
+            const size_t length = details::numberKey (first, last, key);
+
+            if (unlikely ((length == 0) || (length == sizeof (key))))
+            {
+                ++_misses;
+                return dconv::atod (first, last, value);
+            }
+
+            Entry* set = &_entries[details::cacheSlot (details::numberHash (key), details::cacheBits (Size)) & ~static_cast <size_t> (1)];
+
+            for (size_t way = 0; way < 2; ++way)
+            {
+                if (likely (memcmp (set[way]._key, key, sizeof (key)) == 0))
+                {
+                    ++_hits;
+                    value = set[way]._value;
+                    return first + length;
+                }
+            }
+
+            ++_misses;
+            const char* end = dconv::atod (first, last, value);
+
+            // only numbers ending with the run are cached, the run is then enough to convert them.
+            // the most recent entry goes first, the oldest is evicted.
+            if (likely (end == first + length))
+            {
+                set[1] = set[0];
+                memcpy (set[0]._key, key, sizeof (key));
+                set[0]._value = value;
+            }
+
+            return end;
+        }
+
+        /**
+         * @brief string to double conversion.
+         * @param str null-terminated string.
+         * @param value converted value.
+         * @return end position on success, nullptr on failure.
+         */
+        const char* atod (const char* str, double& value)
+        {
+            return atod (str, str + strlen (str), value);
+        }
+
+        /**
+         * @brief get the number of conversions found in cache.
+         * @return number of hits.
+         */
+        size_t hits () const noexcept
+        {
+            return _hits;
+        }
+
+        /**
+         * @brief get the number of conversions not found in cache.
+         * @return number of misses.
+         */
+        size_t misses () const noexcept
+        {
+            return _misses;
+        }
+
+        /**
+         * @brief remove all entries and reset counters.
+         */
+        void clear () noexcept
+        {
+            for (Entry& entry : _entries)
+            {
+                memset (entry._key, 0, sizeof (entry._key));
+            }
+            _hits = _misses = 0;
+        }
+
+    private:
+        /**
+         * @brief cache entry.
+         */
+        struct Entry
+        {
+            char _key[32] = {};         /**< number characters, zero padded (all zeros if empty). */
+            double _value = 0.0;        /**< converted value. */
+        };
+
+        /// cache entries.
+        Entry _entries[Size];
+
+        /// number of hits.
+        size_t _hits = 0;
+
+        /// number of misses.
+        size_t _misses = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_CONFIG_HPP__
+#define __DCONV_CONFIG_HPP__
+
+// DCONV_LIBRARY is defined when using the compiled library (DCONV_BUILD_LIBRARY),
+// DCONV_LIBRARY_SOURCE is also defined when compiling it.
+#if defined(DCONV_LIBRARY)
+// public entry points are out-of-line and power tables are defined once, in the library.
+#define DCONV_API
+#define DCONV_TABLE extern const
+#if !defined(DCONV_LIBRARY_SOURCE)
+#define DCONV_DECLARE_ONLY
+#endif
+#else
+// header only.
+#define DCONV_API inline
+#define DCONV_TABLE constexpr
+#endif
+
+#endif
@@ -0,0 +1,358 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_CSV_HPP__
+#define __DCONV_CSV_HPP__
+
+// dconv.
+#include <dconv/number.hpp>
+#include <dconv/atod.hpp>
+
+// C++.
+#include <string>
+#include <vector>
+
+// C.
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dconv
+{
+    /**
+     * @brief CSV column type.
+     */
+    enum ColumnType
+    {
+        ColumnSkip,         /**< column is not decoded. */
+        ColumnDouble,       /**< column is decoded as double. */
+        ColumnInt64,        /**< column is decoded as int64_t. */
+    };
+
+    namespace details
+    {
+        /**
+         * @brief find the end of a CSV field.
+         * @param pos first position.
+         * @param end last position.
+         * @param delimiter field delimiter.
+         * @return position of the first delimiter or new line, end if none.
+         */
+        inline const char* findSeparator (const char* pos, const char* end, char delimiter) noexcept
+        {
+        #if defined(__SSE2__)
+            const __m128i d = _mm_set1_epi8 (delimiter);
+            const __m128i n = _mm_set1_epi8 ('\n');
+
+            while (end - pos >= 16)
+            {
+                const __m128i c = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (pos));
+                const int mask = _mm_movemask_epi8 (_mm_or_si128 (_mm_cmpeq_epi8 (c, d), _mm_cmpeq_epi8 (c, n)));
+
+                if (mask)
+                {
+                    return pos + __builtin_ctz (mask);
+                }
+
+                pos += 16;
+            }
+        #endif
+
+            while ((pos < end) && (*pos != delimiter) && (*pos != '\n'))
+            {
+                ++pos;
+            }
+
+            return pos;
+        }
+    }
+
+    /**
+     * @brief CSV row decoder into struct of arrays.
+     *
+     * rows have a fixed number of columns, each one being decoded to its own array or skipped.
+     * values are staged per column and appended to the arrays by blocks of rows. quoted fields
+     * are not supported, blank lines are ignored and lines may end with "\r\n".
+     */
+    class CsvDecoder
+    {
+    public:
+        /// number of rows staged before being appended to the arrays.
+        static constexpr size_t _blockSize = 256;
+
+        /**
+         * @brief create a decoder with all columns skipped.
+         * @param columns number of columns.
+         * @param delimiter field delimiter.
+         */
+        explicit CsvDecoder (size_t columns, char delimiter = ',')
+        : _types (columns, ColumnSkip)
+        , _doubles (columns, nullptr)
+        , _ints (columns, nullptr)
+        , _doubleBlock (columns * _blockSize)
+        , _intBlock (columns * _blockSize)
+        , _delimiter (delimiter)
+        {
+        }
+
+        /**
+         * @brief decode a column as double.
+         * @param column column index.
+         * @param output array to append the values to.
+         * @return the decoder.
+         */
+        CsvDecoder& bind (size_t column, std::vector <double>& output)
+        {
+            _types[column] = ColumnDouble;
+            _doubles[column] = &output;
+            return *this;
+        }
+
+        /**
+         * @brief decode a column as int64_t.
+         * @param column column index.
+         * @param output array to append the values to.
+         * @return the decoder.
+         */
+        CsvDecoder& bind (size_t column, std::vector <int64_t>& output)
+        {
+            _types[column] = ColumnInt64;
+            _ints[column] = &output;
+            return *this;
+        }
+
+        /**
+         * @brief skip a column.
+         * @param column column index.
+         * @return the decoder.
+         */
+        CsvDecoder& skip (size_t column)
+        {
+            _types[column] = ColumnSkip;
+            return *this;
+        }
+
+        /**
+         * @brief decode rows and append them to the arrays.
+         *
+         * on error, the rows before the faulty one are appended.
+         * @param first first position.
+         * @param last last position.
+         * @return true on success, false on error (see row () and column ()).
+         */
+        bool decode (const char* first, const char* last)
+        {
+            size_t count = 0;
+            bool success = decodeRows (first, last, count);
+            flush (count);
+            return success;
+        }
+
+        /**
+         * @brief get the line of the last error.
+         * @return line index, starting at 0.
+         */
+        size_t row () const noexcept
+        {
+            return _row;
+        }
+
+        /**
+         * @brief get the column of the last error.
+         * @return column index, starting at 0.
+         */
+        size_t column () const noexcept
+        {
+            return _column;
+        }
+
+    private:
+        /**
+         * @brief decode rows to the staging blocks.
+         * @param pos first position.
+         * @param last last position.
+         * @param count number of rows staged.
+         * @return true on success.
+         */
+        bool decodeRows (const char* pos, const char* last, size_t& count)
+        {
+            const size_t columns = _types.size ();
+
+            if (unlikely (columns == 0))
+            {
+                return pos == last;
+            }
+
+            // fields starting before the last separator are followed by a character that stops the
+            // conversion inside the buffer, the last field is converted from a terminated copy.
+            const char* tail = last;
+            while ((tail > pos) && (tail[-1] != '\n') && (tail[-1] != _delimiter))
+            {
+                --tail;
+            }
+
+            for (_row = 0, _column = 0; pos < last; ++_row, _column = 0)
+            {
+                if ((*pos == '\n') || ((*pos == '\r') && ((pos + 1) < last) && (pos[1] == '\n')))
+                {
+                    pos += (*pos == '\r') + 1;
+                    continue;
+                }
+
+                for (; _column < columns; ++_column)
+                {
+                    const char* sep;
+
+                    if (_types[_column] == ColumnSkip)
+                    {
+                        sep = details::findSeparator (pos, last, _delimiter);
+                    }
+                    else if (likely (pos < tail))
+                    {
+                        sep = decodeField (pos, last, count);
+                    }
+                    else
+                    {
+                        _tail.assign (pos, last);
+                        sep = decodeField (_tail.c_str (), _tail.c_str () + _tail.size (), count);
+                        sep = sep ? pos + (sep - _tail.c_str ()) : nullptr;
+                    }
+
+                    if (unlikely (sep == nullptr))
+                    {
+                        return false;
+                    }
+
+                    // the last field ends the line, the others are followed by the delimiter.
+                    if ((_column + 1) == columns)
+                    {
+                        sep += ((sep + 1) < last) && (*sep == '\r') && (sep[1] == '\n');
+
+                        if (unlikely ((sep < last) && (*sep != '\n')))
+                        {
+                            _column += (*sep == _delimiter);
+                            return false;
+                        }
+                    }
+                    else if (unlikely ((sep == last) || (*sep != _delimiter)))
+                    {
+                        _column += (sep == last) || (*sep == '\n');
+                        return false;
+                    }
+
+                    pos = sep + (sep < last);
+                }
+
+                if (++count == _blockSize)
+                {
+                    flush (count);
+                    count = 0;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief decode a field to the staging block of its column.
+         * @param first first position.
+         * @param last last position.
+         * @param count staged row index.
+         * @return position after the field on success, nullptr on failure.
+         */
+        const char* decodeField (const char* first, const char* last, size_t count)
+        {
+            View view (first, last);
+
+            if (_types[_column] == ColumnDouble)
+            {
+                return details::atod (view, _doubleBlock[(_column * _blockSize) + count]);
+            }
+
+            Number number;
+
+            if (!parseNumber (view, number) || (number._type != NumberInt64))
+            {
+                return nullptr;
+            }
+
+            _intBlock[(_column * _blockSize) + count] = number._int64;
+
+            return view.data ();
+        }
+
+        /**
+         * @brief append the staged rows to the arrays.
+         * @param count number of rows staged.
+         */
+        void flush (size_t count)
+        {
+            for (size_t column = 0; count && (column < _types.size ()); ++column)
+            {
+                if (_types[column] == ColumnDouble)
+                {
+                    const double* block = &_doubleBlock[column * _blockSize];
+                    _doubles[column]->insert (_doubles[column]->end (), block, block + count);
+                }
+                else if (_types[column] == ColumnInt64)
+                {
+                    const int64_t* block = &_intBlock[column * _blockSize];
+                    _ints[column]->insert (_ints[column]->end (), block, block + count);
+                }
+            }
+        }
+
+        /// column types.
+        std::vector <ColumnType> _types;
+
+        /// double arrays.
+        std::vector <std::vector <double>*> _doubles;
+
+        /// int64_t arrays.
+        std::vector <std::vector <int64_t>*> _ints;
+
+        /// double staging blocks, one per column.
+        std::vector <double> _doubleBlock;
+
+        /// int64_t staging blocks, one per column.
+        std::vector <int64_t> _intBlock;
+
+        /// copy of a field ending the buffer.
+        std::string _tail;
+
+        /// field delimiter.
+        char _delimiter;
+
+        /// line of the last error.
+        size_t _row = 0;
+
+        /// column of the last error.
+        size_t _column = 0;
+    };
+}
+
+#endif
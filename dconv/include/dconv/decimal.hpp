@@ -0,0 +1,246 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_DECIMAL_HPP__
+#define __DCONV_DECIMAL_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+// C++.
+#include <algorithm>
+
+// C.
+#include <cstdint>
+
+namespace dconv
+{
+    /**
+     * @brief decimal number, significand * 10^exponent.
+     *
+     * trailing zeros are moved to the exponent, so that equal values have equal decimals.
+     * a truncated decimal keeps its 19 digits, the dropped ones follow the last of them.
+     */
+    struct Decimal
+    {
+        uint64_t _significand;  /**< significant digits, up to 19. */
+        int64_t _exponent;      /**< decimal exponent of the last digit. */
+        bool _negative;         /**< sign. */
+        bool _truncated;        /**< true if non zero digits were dropped after the 19th one. */
+    };
+
+    /**
+     * @brief check whether a decimal holds all the digits it was parsed from.
+     * @param decimal decimal to check.
+     * @return true if no digit was dropped.
+     */
+    inline bool isExact (const Decimal& decimal) noexcept
+    {
+        return !decimal._truncated;
+    }
+
+    /**
+     * @brief equality operator.
+     *
+     * truncated decimals are equal when their 19 kept digits are, use isExact to tell them apart from exact ones.
+     * @param lhs left hand side decimal.
+     * @param rhs right hand side decimal.
+     * @return true if equal.
+     */
+    inline bool operator== (const Decimal& lhs, const Decimal& rhs) noexcept
+    {
+        return (lhs._significand == rhs._significand) && (lhs._exponent == rhs._exponent) &&
+               (lhs._negative == rhs._negative) && (lhs._truncated == rhs._truncated);
+    }
+
+    /**
+     * @brief inequality operator.
+     * @param lhs left hand side decimal.
+     * @param rhs right hand side decimal.
+     * @return true if not equal.
+     */
+    inline bool operator!= (const Decimal& lhs, const Decimal& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    namespace details
+    {
+        /**
+         * @brief move the trailing zeros of the significand to the exponent.
+         *
+         * a truncated significand is left untouched, its last digit is followed by the dropped ones.
+         * @param decimal decimal to normalize.
+         */
+        inline void normalize (Decimal& decimal) noexcept
+        {
+            if (decimal._truncated)
+            {
+                return;
+            }
+
+            if (decimal._significand == 0)
+            {
+                decimal._exponent = 0;
+                return;
+            }
+
+            while ((decimal._significand % 10) == 0)
+            {
+                decimal._significand /= 10;
+                ++decimal._exponent;
+            }
+        }
+    }
+
+    /**
+     * @brief parse a number to its decimal representation.
+     * @param view view positioned at the number, moved past it on success.
+     * @param decimal parsed decimal.
+     * @return true on success, false on grammar error, infinity or not a number (view is left untouched).
+     */
+    inline bool parseDecimal (View& view, Decimal& decimal) noexcept
+    {
+        const View beg (view);
+
+        if (unlikely (!details::isFinite (details::accumulate (view, decimal._negative, decimal._significand, decimal._exponent, decimal._truncated))))
+        {
+            view = beg;
+            return false;
+        }
+
+        details::normalize (decimal);
+
+        return true;
+    }
+
+    /**
+     * @brief parse a number to its decimal representation.
+     * @param first string first position.
+     * @param last string last position.
+     * @param decimal parsed decimal.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* parseDecimal (const char* first, const char* last, Decimal& decimal) noexcept
+    {
+        View view (first, last);
+        return parseDecimal (view, decimal) ? view.data () : nullptr;
+    }
+
+    /**
+     * @brief convert a decimal to the nearest double.
+     *
+     * a truncated decimal is converted as if a non zero digit followed its 19 digits, so a halfway
+     * point among the dropped digits may round either way.
+     * @param decimal decimal to convert.
+     * @return converted value.
+     */
+    inline double decimalToDouble (const Decimal& decimal)
+    {
+        double value;
+
+        if (likely (details::strtodFast (decimal._negative, decimal._significand, decimal._exponent, decimal._truncated, value)))
+        {
+            return value;
+        }
+
+        // the digits are written back, followed by a sticky digit if any was dropped.
+        char buffer[48];
+        char* pos = buffer;
+
+        *pos = '-';
+        pos += decimal._negative;
+
+        uint64_t significand = decimal._significand;
+        char digits[20];
+        int length = 0;
+
+        do
+        {
+            digits[length++] = '0' + (significand % 10);
+            significand /= 10;
+        }
+        while (significand);
+
+        while (length)
+        {
+            *pos++ = digits[--length];
+        }
+
+        int64_t exponent = decimal._exponent;
+
+        if (decimal._truncated)
+        {
+            *pos++ = '1';
+            --exponent;
+        }
+
+        // beyond the range of doubles, the exponent is clamped to one that still underflows or overflows.
+        exponent = std::max <int64_t> (std::min <int64_t> (exponent, 999), -999);
+
+        *pos++ = 'e';
+        pos = details::writeExponent (pos, static_cast <int> (exponent));
+        *pos = '\0';
+
+        details::strtodSlow (View (buffer, pos), value);
+
+        return value;
+    }
+
+    /**
+     * @brief convert a double to its shortest decimal representation.
+     * @param value value to convert (finite).
+     * @return shortest decimal that converts back to value.
+     */
+    inline Decimal doubleToDecimal (double value) noexcept
+    {
+        uint64_t bits;
+        memcpy (&bits, &value, sizeof (double));
+
+        Decimal decimal = {0, 0, (bits >> 63) != 0, false};
+        value = decimal._negative ? -value : value;
+
+        if (value == 0.0)
+        {
+            return decimal;
+        }
+
+        char digits[20];
+        int length, k;
+        details::grisu2 (digits, length, k, value);
+
+        for (int i = 0; i < length; ++i)
+        {
+            decimal._significand = (10 * decimal._significand) + (digits[i] - '0');
+        }
+        decimal._exponent = k;
+
+        details::normalize (decimal);
+
+        return decimal;
+    }
+}
+
+#endif
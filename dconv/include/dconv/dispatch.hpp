@@ -0,0 +1,218 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_DISPATCH_HPP__
+#define __DCONV_DISPATCH_HPP__
+
+// C++.
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DCONV_HAS_DISPATCH
+#endif
+
+namespace dconv
+{
+    /**
+     * @brief SIMD kernel tiers, from the most portable to the widest.
+     */
+    enum SimdTier
+    {
+        SimdScalar = 0,
+        SimdAvx2   = 1,
+        SimdAvx512 = 2,
+    };
+
+    namespace details
+    {
+        /**
+         * @brief get the widest tier supported by the host CPU.
+         * @return widest supported tier.
+         */
+        inline SimdTier detectSimdTier () noexcept
+        {
+        #if defined(DCONV_HAS_DISPATCH)
+            __builtin_cpu_init ();
+
+            if (__builtin_cpu_supports ("avx512f"))
+            {
+                return SimdAvx512;
+            }
+
+            if (__builtin_cpu_supports ("avx2"))
+            {
+                return SimdAvx2;
+            }
+        #endif
+
+            return SimdScalar;
+        }
+
+        /**
+         * @brief get the tier forced for benchmarking (-1 when not forced).
+         * @return forced tier.
+         */
+        inline std::atomic <int>& forcedSimdTier () noexcept
+        {
+            static std::atomic <int> tier (-1);
+            return tier;
+        }
+
+        /**
+         * @brief get the tier used by the dispatched kernels.
+         * @return active tier.
+         */
+        inline SimdTier activeSimdTier () noexcept
+        {
+            static const SimdTier detected = detectSimdTier ();
+            int forced = forcedSimdTier ().load (std::memory_order_relaxed);
+
+            if ((forced >= 0) && (forced < detected))
+            {
+                return static_cast <SimdTier> (forced);
+            }
+
+            return detected;
+        }
+
+        /**
+         * @brief get the reset functions of the resolved kernels.
+         * @return reset functions.
+         */
+        inline std::vector <void (*) ()>& dispatchResets ()
+        {
+            static std::vector <void (*) ()> resets;
+            return resets;
+        }
+
+        /**
+         * @brief get the lock protecting the reset functions.
+         * @return lock.
+         */
+        inline std::mutex& dispatchLock ()
+        {
+            static std::mutex lock;
+            return lock;
+        }
+
+        /**
+         * @brief kernel dispatcher.
+         *
+         * the kernel pointer first targets a resolver that selects the implementation for
+         * the active tier, stores it in place of itself and forwards the call (ifunc style),
+         * so that a resolved call costs a single indirect call.
+         *
+         * Kernel must provide a Function pointer type and a static Function select (SimdTier) member.
+         */
+        template <typename Kernel, typename Function = typename Kernel::Function>
+        struct Dispatch;
+
+        template <typename Kernel, typename Result, typename... Args>
+        struct Dispatch <Kernel, Result (*) (Args...)>
+        {
+            using Function = Result (*) (Args...);
+
+            /**
+             * @brief call the kernel.
+             * @param args kernel arguments.
+             * @return kernel result.
+             */
+            static Result call (Args... args)
+            {
+                return pointer.load (std::memory_order_relaxed) (args...);
+            }
+
+            /**
+             * @brief resolve the kernel for the active tier then call it.
+             * @param args kernel arguments.
+             * @return kernel result.
+             */
+            static Result resolve (Args... args)
+            {
+                {
+                    std::lock_guard <std::mutex> guard (dispatchLock ());
+                    std::vector <void (*) ()>& resets = dispatchResets ();
+
+                    if (std::find (resets.begin (), resets.end (), &reset) == resets.end ())
+                    {
+                        resets.push_back (&reset);
+                    }
+                }
+
+                Function function = Kernel::select (activeSimdTier ());
+                pointer.store (function, std::memory_order_relaxed);
+
+                return function (args...);
+            }
+
+            /**
+             * @brief make the next call resolve the kernel again.
+             */
+            static void reset () noexcept
+            {
+                pointer.store (&resolve, std::memory_order_relaxed);
+            }
+
+            /// kernel pointer.
+            static std::atomic <Function> pointer;
+        };
+
+        template <typename Kernel, typename Result, typename... Args>
+        std::atomic <Result (*) (Args...)> Dispatch <Kernel, Result (*) (Args...)>::pointer (&Dispatch <Kernel, Result (*) (Args...)>::resolve);
+    }
+
+    /**
+     * @brief get the tier used by the dispatched kernels.
+     * @return active tier.
+     */
+    inline SimdTier simdTier () noexcept
+    {
+        return details::activeSimdTier ();
+    }
+
+    /**
+     * @brief force the tier used by the dispatched kernels, mainly for benchmarking.
+     * @param tier tier to use, lowered to the widest tier supported by the host CPU.
+     * @return active tier.
+     * @note must not be called while kernels are running in other threads.
+     */
+    inline SimdTier forceSimdTier (SimdTier tier)
+    {
+        details::forcedSimdTier ().store (tier, std::memory_order_relaxed);
+
+        std::lock_guard <std::mutex> guard (details::dispatchLock ());
+
+        for (auto reset : details::dispatchResets ())
+        {
+            reset ();
+        }
+
+        return simdTier ();
+    }
+}
+
+#endif
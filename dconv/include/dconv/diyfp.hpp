@@ -32,9 +32,52 @@
 // C.
 #include <cstdint>
 #include <cstring>
+#include <cfloat>
+
+// DCONV_NO_INT128 disables the 128-bit integer paths, so that the code used on 32-bit targets
+// can also be built and tested on a 64-bit host.
+#if defined(__SIZEOF_INT128__) && !defined(DCONV_NO_INT128)
+#define DCONV_HAS_INT128
+#endif
+
+#if defined(DCONV_HAS_INT128) && ((LDBL_MANT_DIG == 64) || (LDBL_MANT_DIG == 113))
+#define DCONV_HAS_WIDE_LONG_DOUBLE
+#endif
+
+#if defined(DCONV_HAS_INT128) && defined(__SIZEOF_FLOAT128__)
+#define DCONV_HAS_FLOAT128
+#endif
 
 namespace dconv
 {
+    namespace details
+    {
+        /**
+         * @brief full 64x64 bits multiplication.
+         * @param a first operand.
+         * @param b second operand.
+         * @param high high 64 bits of the product.
+         * @return low 64 bits of the product.
+         */
+        inline constexpr uint64_t umul128 (uint64_t a, uint64_t b, uint64_t& high) noexcept
+        {
+        #if defined(DCONV_HAS_INT128)
+            const __uint128_t product = static_cast <__uint128_t> (a) * b;
+            high = static_cast <uint64_t> (product >> 64);
+            return static_cast <uint64_t> (product);
+        #else
+            // 32x32 bits partial products, a single mul instruction each on 32-bit targets.
+            const uint64_t ll = static_cast <uint64_t> (static_cast <uint32_t> (a)) * static_cast <uint32_t> (b);
+            const uint64_t lh = static_cast <uint64_t> (static_cast <uint32_t> (a)) * static_cast <uint32_t> (b >> 32);
+            const uint64_t hl = static_cast <uint64_t> (static_cast <uint32_t> (a >> 32)) * static_cast <uint32_t> (b);
+            const uint64_t hh = static_cast <uint64_t> (static_cast <uint32_t> (a >> 32)) * static_cast <uint32_t> (b >> 32);
+            const uint64_t middle = (ll >> 32) + static_cast <uint32_t> (lh) + static_cast <uint32_t> (hl);
+            high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+            return (middle << 32) | static_cast <uint32_t> (ll);
+        #endif
+        }
+    }
+
     /**
      * @brief hand made floating point.
      */
@@ -178,25 +221,10 @@ namespace dconv
          */
         inline constexpr DiyFp& operator*= (const DiyFp& rhs) noexcept
         {
-        #if defined(__SIZEOF_INT128__)
-            __uint128_t product = static_cast <__uint128_t> (_mantissa) * static_cast <__uint128_t> (rhs._mantissa);
-            _mantissa = static_cast <uint64_t> ((product >> 64) + ((product >> 63) & 1));
-        #else
-            uint64_t M32 = 0xFFFFFFFFU;
-
-            uint64_t a = _mantissa >> 32;
-            uint64_t b = _mantissa & M32;
-            uint64_t c = rhs._mantissa >> 32;
-            uint64_t d = rhs._mantissa & M32;
-
-            uint64_t ac = a * c;
-            uint64_t bc = b * c;
-            uint64_t ad = a * d;
-            uint64_t bd = b * d;
-
-            uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32) + (1U << 31);
-            _mantissa = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
-        #endif
+            // high 64 bits of the product, rounded.
+            uint64_t high = 0;
+            const uint64_t low = details::umul128 (_mantissa, rhs._mantissa, high);
+            _mantissa = high + (low >> 63);
             _exponent += rhs._exponent + 64;
 
             return *this;
@@ -248,6 +276,358 @@ namespace dconv
     {
         return DiyFp (lhs) *= rhs;
     }
+
+    namespace details
+    {
+        /// widest native unsigned integer, holds the mantissas of the exact conversion.
+    #if defined(DCONV_HAS_INT128)
+        using WideUInt = __uint128_t;
+    #else
+        using WideUInt = uint64_t;
+    #endif
+
+        /**
+         * @brief count leading zeros.
+         * @param value non zero value.
+         * @return leading zeros count.
+         */
+        inline constexpr int clz (uint64_t value) noexcept
+        {
+            return __builtin_clzll (value);
+        }
+
+    #if defined(DCONV_HAS_INT128)
+        /**
+         * @brief count leading zeros.
+         * @param value non zero value.
+         * @return leading zeros count.
+         */
+        inline constexpr int clz (__uint128_t value) noexcept
+        {
+            const uint64_t hi = static_cast <uint64_t> (value >> 64);
+            return hi ? __builtin_clzll (hi) : 64 + __builtin_clzll (static_cast <uint64_t> (value));
+        }
+    #endif
+
+        template <typename Float>
+        struct Wide;
+    }
+
+#if defined(DCONV_HAS_INT128)
+    namespace details
+    {
+        /**
+         * @brief wide floating point format traits.
+         */
+        template <int Digits>
+        struct WideFormat;
+
+        /**
+         * @brief x87 80 bits extended precision format (explicit integer bit).
+         */
+        template <>
+        struct WideFormat <64>
+        {
+            /// mantissa size (integer bit included).
+            static constexpr int _mantissaSize = 64;
+
+            /// stored fraction size.
+            static constexpr int _fractionSize = 63;
+
+            /// exponent position.
+            static constexpr int _exponentShift = 64;
+
+            /// sign position.
+            static constexpr int _signShift = 79;
+
+            /// stored mantissa mask.
+            static constexpr __uint128_t _storedMask = ~static_cast <uint64_t> (0);
+        };
+
+        /**
+         * @brief IEEE 754 binary128 format (hidden integer bit).
+         */
+        template <>
+        struct WideFormat <113>
+        {
+            /// mantissa size (hidden bit included).
+            static constexpr int _mantissaSize = 113;
+
+            /// stored fraction size.
+            static constexpr int _fractionSize = 112;
+
+            /// exponent position.
+            static constexpr int _exponentShift = 112;
+
+            /// sign position.
+            static constexpr int _signShift = 127;
+
+            /// stored mantissa mask.
+            static constexpr __uint128_t _storedMask = (static_cast <__uint128_t> (1) << 112) - 1;
+        };
+
+        /**
+         * @brief wide floating point type traits.
+         */
+        template <typename Float>
+        struct WideTraits;
+
+    #if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+        template <>
+        struct WideTraits <long double> : WideFormat <LDBL_MANT_DIG>
+        {
+        };
+    #endif
+
+    #if defined(DCONV_HAS_FLOAT128)
+        template <>
+        struct WideTraits <__float128> : WideFormat <113>
+        {
+        };
+    #endif
+
+        /**
+         * @brief common wide floating point definitions.
+         */
+        template <typename Float>
+        struct Wide : WideTraits <Float>
+        {
+            using Traits = WideTraits <Float>;
+
+            /// exponent bias.
+            static constexpr int _exponentBias = 0x3FFF + Traits::_fractionSize;
+
+            /// biased exponent of infinity.
+            static constexpr int _maxExponent = 0x7FFF;
+
+            /// hidden bit.
+            static constexpr __uint128_t _hiddenBit = static_cast <__uint128_t> (1) << Traits::_fractionSize;
+
+            /**
+             * @brief get the binary representation of a wide floating point.
+             * @param value wide floating point.
+             * @return binary representation.
+             */
+            static __uint128_t toBits (Float value) noexcept
+            {
+                __uint128_t bits = 0;
+                memcpy (&bits, &value, sizeof (Float) < sizeof (bits) ? sizeof (Float) : sizeof (bits));
+                return bits & ((static_cast <__uint128_t> (1) << Traits::_signShift << 1) - 1);
+            }
+
+            /**
+             * @brief build a wide floating point from its components.
+             * @param negative sign.
+             * @param exponent biased exponent.
+             * @param mantissa mantissa (hidden bit included).
+             * @return wide floating point.
+             */
+            static Float fromBits (bool negative, int exponent, __uint128_t mantissa) noexcept
+            {
+                __uint128_t bits = (mantissa & Traits::_storedMask)
+                                 | (static_cast <__uint128_t> (exponent) << Traits::_exponentShift)
+                                 | (static_cast <__uint128_t> (negative) << Traits::_signShift);
+                Float value = 0;
+                memcpy (&value, &bits, sizeof (Float) < sizeof (bits) ? sizeof (Float) : sizeof (bits));
+                return value;
+            }
+        };
+    }
+
+    /**
+     * @brief hand made 128 bits floating point.
+     */
+    class DiyFp128
+    {
+    public:
+        /**
+         * @brief default constructor.
+         */
+        constexpr DiyFp128 () noexcept = default;
+
+        /**
+         * @brief copy constructor.
+         * @param other object to copy.
+         */
+        constexpr DiyFp128 (const DiyFp128& other) noexcept = default;
+
+        /**
+         * @brief copy assignment.
+         * @param other object to copy.
+         * @return a reference of the current object.
+         */
+        constexpr DiyFp128& operator= (const DiyFp128& other) noexcept = default;
+
+        /**
+         * @brief create floating point using a wide floating point.
+         * @param value long double or __float128 value.
+         */
+        template <typename Float>
+        explicit DiyFp128 (Float value) noexcept
+        {
+            using Format = details::Wide <Float>;
+
+            __uint128_t bits = Format::toBits (value);
+
+            _mantissa = bits & Format::_storedMask;
+            _exponent = static_cast <int> ((bits >> Format::_exponentShift) & Format::_maxExponent);
+
+            if (_exponent)
+            {
+                _mantissa |= Format::_hiddenBit;
+                _exponent -= Format::_exponentBias;
+            }
+            else
+            {
+                _exponent = 1 - Format::_exponentBias;
+            }
+        }
+
+        /**
+         * @brief create floating point using mantissa and exponent.
+         * @param hi mantissa high part.
+         * @param lo mantissa low part.
+         * @param exponent exponent.
+         */
+        constexpr DiyFp128 (uint64_t hi, uint64_t lo, int exponent) noexcept
+        : _mantissa ((static_cast <__uint128_t> (hi) << 64) | lo),
+          _exponent (exponent)
+        {
+        }
+
+        /**
+         * @brief create floating point using mantissa and exponent.
+         * @param mantissa mantissa.
+         * @param exponent exponent.
+         */
+        constexpr DiyFp128 (__uint128_t mantissa, int exponent) noexcept
+        : _mantissa (mantissa),
+          _exponent (exponent)
+        {
+        }
+
+        /**
+         * @brief destroy instance.
+         */
+        ~DiyFp128 () = default;
+
+        /**
+         * @brief count leading zeros.
+         * @param value non zero value.
+         * @return leading zeros count.
+         */
+        static constexpr int clz (__uint128_t value) noexcept
+        {
+            return details::clz (value);
+        }
+
+        /**
+         * @brief normalize floating point.
+         * @return a reference of the current object.
+         */
+        inline constexpr DiyFp128& normalize () noexcept
+        {
+            if (_mantissa == 0)
+            {
+                return *this;
+            }
+
+            int shift = clz (_mantissa);
+            _mantissa <<= shift;
+            _exponent  -= shift;
+
+            return *this;
+        }
+
+        /**
+         * @brief get normalized boundaries.
+         * @param minus lower boundary.
+         * @param plus upper boundary.
+         */
+        template <typename Float>
+        constexpr void normalizedBoundaries (DiyFp128& minus, DiyFp128& plus) const noexcept
+        {
+            using Format = details::Wide <Float>;
+
+            plus._mantissa = (_mantissa << 1) + 1;
+            plus._exponent = _exponent - 1;
+            plus.normalize ();
+
+            const bool special = __builtin_expect ((_mantissa == Format::_hiddenBit) && (_exponent > 1 - Format::_exponentBias), 0);
+            minus._mantissa = (_mantissa << (special ? 2 : 1)) - 1;
+            minus._exponent = _exponent - (special ? 2 : 1);
+
+            const int diff = minus._exponent - plus._exponent;
+            minus._mantissa <<= diff;
+            minus._exponent = plus._exponent;
+        }
+
+        /**
+         * @brief minus operator
+         * @param rhs floating point.
+         * @return a reference of the current object.
+         */
+        inline constexpr DiyFp128& operator-= (const DiyFp128& rhs) noexcept
+        {
+            _mantissa -= rhs._mantissa;
+            return *this;
+        }
+
+        /**
+         * @brief multiplication operator.
+         * @param rhs floating point.
+         * @return a reference of the current object.
+         */
+        inline constexpr DiyFp128& operator*= (const DiyFp128& rhs) noexcept
+        {
+            const __uint128_t M64 = 0xFFFFFFFFFFFFFFFFU;
+
+            __uint128_t a = _mantissa >> 64;
+            __uint128_t b = _mantissa & M64;
+            __uint128_t c = rhs._mantissa >> 64;
+            __uint128_t d = rhs._mantissa & M64;
+
+            __uint128_t ac = a * c;
+            __uint128_t bc = b * c;
+            __uint128_t ad = a * d;
+            __uint128_t bd = b * d;
+
+            __uint128_t tmp = (bd >> 64) + (ad & M64) + (bc & M64) + (static_cast <__uint128_t> (1) << 63);
+            _mantissa = ac + (ad >> 64) + (bc >> 64) + (tmp >> 64);
+            _exponent += rhs._exponent + 128;
+
+            return *this;
+        }
+
+        /// mantissa.
+        __uint128_t _mantissa = 0;
+
+        /// exponent.
+        int _exponent = 0;
+    };
+
+    /**
+     * @brief minus operator
+     * @param lhs floating point.
+     * @param rhs floating point.
+     * @return a floating point from lhs minus rhs.
+     */
+    inline constexpr DiyFp128 operator- (const DiyFp128& lhs, const DiyFp128& rhs)
+    {
+        return DiyFp128 (lhs) -= rhs;
+    }
+
+    /**
+     * @brief multiplication operator.
+     * @param lhs floating point.
+     * @param rhs floating point.
+     * @return a floating point from lhs multiplied by rhs.
+     */
+    inline constexpr DiyFp128 operator* (const DiyFp128& lhs, const DiyFp128& rhs)
+    {
+        return DiyFp128 (lhs) *= rhs;
+    }
+#endif
 }
 
 #endif
@@ -26,7 +26,14 @@
 #define __DCONV_DTOA_HPP__
 
 // dconv.
+#include <dconv/config.hpp>
+#include <dconv/dtoapow128.hpp>
 #include <dconv/dtoapow.hpp>
+#include <dconv/view.hpp>
+
+// C++.
+#include <algorithm>
+#include <limits>
 
 // C.
 #include <cstring>
@@ -36,12 +43,22 @@ namespace dconv
 {
     namespace details
     {
-        inline char* writeExponent (char* buffer, int k)
+        template <typename CharT>
+        inline CharT* writeExponent (CharT* buffer, int k)
         {
             *buffer = '-';
             buffer += (k < 0);
             k = (k < 0) ? -k : k;
-            if (k >= 100)
+            if (k >= 1000)
+            {
+                *buffer++ = '0' + k / 1000;
+                k %= 1000;
+                *buffer++ = '0' + k / 100;
+                k %= 100;
+                *buffer++ = '0' + k / 10;
+                k %= 10;
+            }
+            else if (k >= 100)
             {
                 *buffer++ = '0' + k / 100;
                 k %= 100;
@@ -57,32 +74,58 @@ namespace dconv
             return buffer;
         }
 
-        inline char* prettify (char* buffer, int length, int k)
+        template <typename CharT>
+        inline int writeDigits (CharT* buffer, uint64_t value)
         {
-            int kk = length + k;
+            CharT tmp[20];
+            CharT* beg = tmp + 20;
+            do
+            {
+                *--beg = '0' + (value % 10);
+                value /= 10;
+            }
+            while (value);
+            int length = static_cast <int> (tmp + 20 - beg);
+            memcpy (buffer, beg, length * sizeof (CharT));
+            return length;
+        }
 
-            if ((length <= kk) && (kk <= 21))
+        template <typename CharT>
+        inline CharT* positional (CharT* buffer, int length, int kk)
+        {
+            if (length <= kk)
             {
-                memset (buffer + length, '0', kk - length);
+                std::fill_n (buffer + length, kk - length, CharT ('0'));
                 buffer[kk] = '.';
                 buffer[kk + 1] = '0';
                 return &buffer[kk + 2];
             }
-            else if ((0 < kk) && (kk <= 21))
+            else if (0 < kk)
             {
-                memmove (&buffer[kk + 1], &buffer[kk], length - kk);
+                memmove (&buffer[kk + 1], &buffer[kk], (length - kk) * sizeof (CharT));
                 buffer[kk] = '.';
                 return &buffer[length + 1];
             }
-            else if ((-6 < kk) && (kk <= 0))
+            else
             {
                 int offset = 2 - kk;
-                memmove (&buffer[offset], &buffer[0], length);
+                memmove (&buffer[offset], &buffer[0], length * sizeof (CharT));
                 buffer[0] = '0';
                 buffer[1] = '.';
-                memset (&buffer[2], '0', offset - 2);
+                std::fill_n (&buffer[2], offset - 2, CharT ('0'));
                 return &buffer[length + offset];
             }
+        }
+
+        template <typename CharT>
+        inline CharT* prettify (CharT* buffer, int length, int k)
+        {
+            int kk = length + k;
+
+            if ((-6 < kk) && (kk <= 21))
+            {
+                return positional (buffer, length, kk);
+            }
             else if (length == 1)
             {
                 buffer[1] = 'e';
@@ -90,18 +133,200 @@ namespace dconv
             }
             else
             {
-                memmove (&buffer[2], &buffer[1], length - 1);
+                memmove (&buffer[2], &buffer[1], (length - 1) * sizeof (CharT));
                 buffer[1] = '.';
                 buffer[length + 1] = 'e';
                 return writeExponent (&buffer[length + 2], kk - 1);
             }
         }
 
-        inline void grisuRound (char* buffer, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w)
+        /**
+         * @brief get the final position of a digit.
+         * @param i digit index.
+         * @param dot index of the digit preceded by the decimal point.
+         * @return digit position.
+         */
+        inline constexpr int digitPos (int i, int dot) noexcept
+        {
+            return i + (i >= dot);
+        }
+
+        /**
+         * @brief get the index of the digit preceded by the decimal point.
+         * @param kk decimal exponent of the first digit plus one.
+         * @return index of the digit preceded by the decimal point, INT_MAX if none.
+         */
+        inline constexpr int dotIndex (int kk) noexcept
+        {
+            return ((-6 < kk) && (kk <= 21)) ? ((kk > 0) ? kk : std::numeric_limits <int>::max ()) : 1;
+        }
+
+        /**
+         * @brief write the characters that don't depend on the number of digits.
+         * @param buffer buffer to write to.
+         * @param kk decimal exponent of the first digit plus one.
+         * @return position of the first digit.
+         */
+        template <typename CharT>
+        inline CharT* placeLeading (CharT* buffer, int kk)
+        {
+            if ((-6 < kk) && (kk <= 0))
+            {
+                buffer[0] = '0';
+                buffer[1] = '.';
+                std::fill_n (&buffer[2], -kk, CharT ('0'));
+                return &buffer[2 - kk];
+            }
+            buffer[dotIndex (kk)] = '.';
+            return buffer;
+        }
+
+        /**
+         * @brief write the trailing characters of digits already in their final positions.
+         * @param digits position of the first digit.
+         * @param length number of digits.
+         * @param kk decimal exponent of the first digit plus one.
+         * @return end position.
+         */
+        template <typename CharT>
+        inline CharT* placeTrailing (CharT* digits, int length, int kk)
+        {
+            if ((-6 < kk) && (kk <= 21))
+            {
+                if (kk <= 0)
+                {
+                    return &digits[length];
+                }
+                else if (length <= kk)
+                {
+                    std::fill_n (digits + length, kk - length, CharT ('0'));
+                    digits[kk] = '.';
+                    digits[kk + 1] = '0';
+                    return &digits[kk + 2];
+                }
+                return &digits[length + 1];
+            }
+            else if (length == 1)
+            {
+                digits[1] = 'e';
+                return writeExponent (&digits[2], kk - 1);
+            }
+            digits[length + 1] = 'e';
+            return writeExponent (&digits[length + 2], kk - 1);
+        }
+
+        /**
+         * @brief copy digits to their final positions.
+         * @param buffer buffer to write to.
+         * @param digits digits.
+         * @param length number of digits.
+         * @param k decimal exponent of the last digit.
+         * @return end position.
+         */
+        template <typename CharT>
+        inline CharT* place (CharT* buffer, const CharT* digits, int length, int k)
+        {
+            const int kk = length + k;
+            const int dot = dotIndex (kk);
+            CharT* first = placeLeading (buffer, kk);
+
+            if (dot < length)
+            {
+                memcpy (first, digits, dot * sizeof (CharT));
+                memcpy (first + dot + 1, digits + dot, (length - dot) * sizeof (CharT));
+            }
+            else
+            {
+                memcpy (first, digits, length * sizeof (CharT));
+            }
+
+            return placeTrailing (first, length, kk);
+        }
+
+        inline int exponentLength (int k) noexcept
+        {
+            int length = (k < 0);
+            k = (k < 0) ? -k : k;
+            return length + 1 + (k >= 10) + (k >= 100) + (k >= 1000);
+        }
+
+        inline int prettifyLength (int length, int k) noexcept
+        {
+            int kk = length + k;
+
+            if ((-6 < kk) && (kk <= 21))
+            {
+                if (length <= kk)
+                {
+                    return kk + 2;
+                }
+                else if (0 < kk)
+                {
+                    return length + 1;
+                }
+                return length + 2 - kk;
+            }
+            else if (length == 1)
+            {
+                return 2 + exponentLength (kk - 1);
+            }
+            return length + 2 + exponentLength (kk - 1);
+        }
+
+        /**
+         * @brief write digits with the shortest notation.
+         *
+         * integers get no fractional part, and the exponent notation uses the digits as an integer
+         * significand ("123e-9") whenever it is shorter than the positional one.
+         * @param buffer buffer to write to.
+         * @param digits digits.
+         * @param length number of digits.
+         * @param k decimal exponent of the last digit.
+         * @return end position.
+         */
+        template <typename CharT>
+        inline CharT* placeShortest (CharT* buffer, const CharT* digits, int length, int k)
+        {
+            const int kk = length + k;
+
+            if (k >= 0)
+            {
+                memcpy (buffer, digits, length * sizeof (CharT));
+                if (k <= 1 + exponentLength (k))
+                {
+                    std::fill_n (buffer + length, k, CharT ('0'));
+                    return buffer + length + k;
+                }
+                buffer[length] = 'e';
+                return writeExponent (buffer + length + 1, k);
+            }
+            else if (kk > 0)
+            {
+                memcpy (buffer, digits, kk * sizeof (CharT));
+                buffer[kk] = '.';
+                memcpy (buffer + kk + 1, digits + kk, (length - kk) * sizeof (CharT));
+                return buffer + length + 1;
+            }
+            else if ((2 - kk) <= (1 + exponentLength (k)))
+            {
+                buffer[0] = '0';
+                buffer[1] = '.';
+                std::fill_n (&buffer[2], -kk, CharT ('0'));
+                memcpy (buffer + 2 - kk, digits, length * sizeof (CharT));
+                return buffer + length + 2 - kk;
+            }
+            memcpy (buffer, digits, length * sizeof (CharT));
+            buffer[length] = 'e';
+            return writeExponent (buffer + length + 1, k);
+        }
+
+        template <typename CharT>
+        inline void grisuRound (CharT* buffer, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w,
+                                int dot = std::numeric_limits <int>::max ())
         {
             while (rest < wp_w && delta - rest >= ten_kappa && (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
             {
-                --buffer[length - 1];
+                --buffer[digitPos (length - 1, dot)];
                 rest += ten_kappa;
             }
         }
@@ -120,7 +345,9 @@ namespace dconv
             return 10;
         }
 
-        inline void digitsGen (DiyFp W, DiyFp Mp, uint64_t delta, char* buffer, int& length, int& k)
+        template <typename CharT>
+        inline bool digitsGenIntegral (DiyFp W, DiyFp Mp, uint64_t delta, CharT* buffer, int& length, int& k,
+                                       int dot = std::numeric_limits <int>::max ())
         {
             static const uint32_t kPow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
             DiyFp one (static_cast <uint64_t> (1) << -Mp._exponent, Mp._exponent);
@@ -149,18 +376,30 @@ namespace dconv
                 }
                 if (d || length)
                 {
-                    buffer[length++] = '0' + d;
+                    buffer[digitPos (length++, dot)] = '0' + d;
                 }
                 --kappa;
                 uint64_t tmp = (static_cast <uint64_t> (p1) << -one._exponent) + p2;
                 if (tmp <= delta)
                 {
                     k += kappa;
-                    grisuRound (buffer, length, delta, tmp, static_cast <uint64_t> (kPow10[kappa]) << -one._exponent, wp_w._mantissa);
-                    return;
+                    grisuRound (buffer, length, delta, tmp, static_cast <uint64_t> (kPow10[kappa]) << -one._exponent, wp_w._mantissa, dot);
+                    return true;
                 }
             }
 
+            return false;
+        }
+
+        template <typename CharT>
+        inline void digitsGenFractional (DiyFp W, DiyFp Mp, uint64_t delta, CharT* buffer, int& length, int& k,
+                                         int dot = std::numeric_limits <int>::max ())
+        {
+            DiyFp one (static_cast <uint64_t> (1) << -Mp._exponent, Mp._exponent);
+            DiyFp wp_w = Mp - W;
+            uint64_t p2 = Mp._mantissa & (one._mantissa - 1);
+            int kappa = 0;
+
             uint64_t unit = 1;
             for (;;)
             {
@@ -168,32 +407,85 @@ namespace dconv
                 char d = static_cast <char> (p2 >> -one._exponent);
                 if (d || length)
                 {
-                    buffer[length++] = '0' + d;
+                    buffer[digitPos (length++, dot)] = '0' + d;
                 }
                 p2 &= one._mantissa - 1;
                 --kappa;
                 if (p2 < delta)
                 {
                     k += kappa;
-                    grisuRound (buffer, length, delta, p2, one._mantissa, wp_w._mantissa * unit);
+                    grisuRound (buffer, length, delta, p2, one._mantissa, wp_w._mantissa * unit, dot);
                     return;
                 }
             }
         }
 
+        template <typename CharT>
+        inline void digitsGen (DiyFp W, DiyFp Mp, uint64_t delta, CharT* buffer, int& length, int& k,
+                               int dot = std::numeric_limits <int>::max ())
+        {
+            if (!digitsGenIntegral (W, Mp, delta, buffer, length, k, dot))
+            {
+                digitsGenFractional (W, Mp, delta, buffer, length, k, dot);
+            }
+        }
+
         inline int kComputation (int exp, int alpha)
         {
-            return static_cast <int> (::ceil ((alpha - exp + 63) * 0.30102999566398114));
+            // ceil ((alpha - exp + 63) * log10 (2)) in integer arithmetic, so that it doesn't depend
+            // on floating point semantics (exact for |alpha - exp + 63| <= 20000).
+            return static_cast <int> (-((-static_cast <int64_t> (alpha - exp + 63) * 661971961083LL) >> 41));
+        }
+
+        template <typename CharT>
+        inline void grisu2 (CharT* buffer, int& length, int& k, const DiyFp& val, DiyFp minus, DiyFp plus)
+        {
+            int mk = kComputation (plus._exponent + 64, -59);
+            const DiyFp& c_mk = dtoapow[mk + 343];
+
+            minus *= c_mk;
+            plus  *= c_mk;
+
+            ++minus._mantissa;
+            --plus._mantissa;
+
+            k = -mk;
+
+            digitsGen (val * c_mk, plus, plus._mantissa - minus._mantissa, buffer, length, k);
+        }
+
+        template <typename CharT>
+        inline void grisu2 (CharT* buffer, int& length, int& k, double value)
+        {
+            DiyFp val (value), minus, plus;
+            val.normalizedBoundaries (minus, plus);
+            grisu2 (buffer, length, k, val.normalize (), minus, plus);
         }
 
-        inline void grisu2 (char* buffer, int& length, int& k, double value)
+        /**
+         * @brief generate the shortest digits within half a unit of a significant digit.
+         * @param buffer buffer to write the digits to.
+         * @param length number of digits.
+         * @param k decimal exponent of the last digit.
+         * @param value value to convert (positive).
+         * @param significantDigits significant digit whose half unit bounds the error (1 to 17).
+         */
+        template <typename CharT>
+        inline void grisu2Approx (CharT* buffer, int& length, int& k, double value, int significantDigits)
         {
+            static const uint64_t kPow10[] = {
+                1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+                10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+                1000000000000000ULL, 10000000000000000ULL
+            };
+
             DiyFp val (value), minus, plus;
             val.normalizedBoundaries (minus, plus);
 
             int mk = kComputation (plus._exponent + 64, -59);
             const DiyFp& c_mk = dtoapow[mk + 343];
 
+            DiyFp w = val.normalize () * c_mk;
             minus *= c_mk;
             plus  *= c_mk;
 
@@ -202,8 +494,200 @@ namespace dconv
 
             k = -mk;
 
+            // the scaled value has at most 3 integral digits, so half a unit of the requested digit is at most
+            // half the value. it is shifted by one bit so that the widened upper boundary can't overflow.
+            const int shift = static_cast <int> (digitsCount (static_cast <uint32_t> (w._mantissa >> -w._exponent))) - significantDigits;
+            DiyFp half (0, w._exponent + 1);
+            half._mantissa = (shift >= 0) ? (kPow10[shift] << (-half._exponent - 1)) :
+                             (((static_cast <uint64_t> (1) << (-half._exponent - 1)) + (kPow10[-shift] >> 1)) / kPow10[-shift]);
+
+            if ((2 * half._mantissa) <= ((plus._mantissa - minus._mantissa) >> 1))
+            {
+                // no wider than the rounding interval, the shortest roundtrip digits are used.
+                digitsGen (w, plus, plus._mantissa - minus._mantissa, buffer, length, k);
+                return;
+            }
+
+            w._mantissa >>= 1;
+            ++w._exponent;
+
+            DiyFp upper (w._mantissa + half._mantissa, w._exponent);
+
+            // in the last binade, the upper boundary of the largest double is kept so that the output doesn't parse to infinity.
+            if (unlikely (value >= std::ldexp (1.0, 1023)))
+            {
+                DiyFp maxMinus, maxPlus;
+                DiyFp (std::numeric_limits <double>::max ()).normalizedBoundaries (maxMinus, maxPlus);
+                maxPlus *= c_mk;
+                upper._mantissa = std::min (upper._mantissa, (maxPlus._mantissa - 1) >> 1);
+            }
+
+            digitsGen (w, upper, upper._mantissa - (w._mantissa - half._mantissa), buffer, length, k);
+        }
+
+        template <typename CharT>
+        inline CharT* writeZero (CharT* buffer)
+        {
+            buffer[0] = '0';
+            buffer[1] = '.';
+            buffer[2] = '0';
+            return buffer + 3;
+        }
+
+        template <typename CharT>
+        inline CharT* dtoa (CharT* buffer, double value)
+        {
+            uint64_t bits;
+            memcpy (&bits, &value, sizeof(double));
+            bool is_negative = (bits >> 63) != 0;
+
+            *buffer = '-';
+            buffer += is_negative;
+            value = is_negative ? -value : value;
+
+            if (value == 0.0)
+            {
+                return writeZero (buffer);
+            }
+
+            DiyFp val (value), minus, plus;
+            val.normalizedBoundaries (minus, plus);
+
+            int mk = kComputation (plus._exponent + 64, -59);
+            const DiyFp& c_mk = dtoapow[mk + 343];
+
+            minus *= c_mk;
+            plus  *= c_mk;
+
+            ++minus._mantissa;
+            --plus._mantissa;
+
+            // the first digit comes from the integral part of the scaled upper boundary, so the position
+            // of the decimal point is known before generating the digits, that go to their final positions.
+            const int kk = static_cast <int> (digitsCount (static_cast <uint32_t> (plus._mantissa >> -plus._exponent))) - mk;
+            CharT* digits = placeLeading (buffer, kk);
+
+            int length = 0, k = -mk;
+            digitsGen (val.normalize () * c_mk, plus, plus._mantissa - minus._mantissa, digits, length, k, dotIndex (kk));
+            return placeTrailing (digits, length, kk);
+        }
+
+    #if defined(DCONV_HAS_INT128)
+        template <typename CharT>
+        inline void grisuRound (CharT* buffer, int length, __uint128_t delta, __uint128_t rest, __uint128_t ten_kappa, __uint128_t wp_w)
+        {
+            while (rest < wp_w && delta - rest >= ten_kappa && (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
+            {
+                --buffer[length - 1];
+                rest += ten_kappa;
+            }
+        }
+
+        template <typename CharT>
+        inline void digitsGen (DiyFp128 W, DiyFp128 Mp, __uint128_t delta, CharT* buffer, int& length, int& k)
+        {
+            static const uint32_t kPow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+            DiyFp128 one (static_cast <__uint128_t> (1) << -Mp._exponent, Mp._exponent);
+            DiyFp128 wp_w = Mp - W;
+            uint32_t p1 = static_cast <uint32_t> (Mp._mantissa >> -one._exponent);
+            __uint128_t p2 = Mp._mantissa & (one._mantissa - 1);
+            int kappa = static_cast <int> (digitsCount (p1));
+            length = 0;
+
+            while (kappa > 0)
+            {
+                uint32_t d = 0;
+                switch (kappa)
+                {
+                    case 10: d = p1 / 1000000000; p1 %= 1000000000; break;
+                    case  9: d = p1 / 100000000;  p1 %= 100000000;  break;
+                    case  8: d = p1 / 10000000;   p1 %= 10000000;   break;
+                    case  7: d = p1 / 1000000;    p1 %= 1000000;    break;
+                    case  6: d = p1 / 100000;     p1 %= 100000;     break;
+                    case  5: d = p1 / 10000;      p1 %= 10000;      break;
+                    case  4: d = p1 / 1000;       p1 %= 1000;       break;
+                    case  3: d = p1 / 100;        p1 %= 100;        break;
+                    case  2: d = p1 / 10;         p1 %= 10;         break;
+                    case  1: d = p1;              p1  = 0;          break;
+                    default:                                        break;
+                }
+                if (d || length)
+                {
+                    buffer[length++] = '0' + d;
+                }
+                --kappa;
+                __uint128_t tmp = (static_cast <__uint128_t> (p1) << -one._exponent) + p2;
+                if (tmp <= delta)
+                {
+                    k += kappa;
+                    grisuRound (buffer, length, delta, tmp, static_cast <__uint128_t> (kPow10[kappa]) << -one._exponent, wp_w._mantissa);
+                    return;
+                }
+            }
+
+            __uint128_t unit = 1;
+            for (;;)
+            {
+                p2 *= 10; delta *= 10; unit *= 10;
+                char d = static_cast <char> (p2 >> -one._exponent);
+                if (d || length)
+                {
+                    buffer[length++] = '0' + d;
+                }
+                p2 &= one._mantissa - 1;
+                --kappa;
+                if (p2 < delta)
+                {
+                    k += kappa;
+                    grisuRound (buffer, length, delta, p2, one._mantissa, wp_w._mantissa * unit);
+                    return;
+                }
+            }
+        }
+
+        template <typename Float, typename CharT>
+        inline void grisu2 (CharT* buffer, int& length, int& k, Float value)
+        {
+            DiyFp128 val (value), minus, plus;
+            val.normalizedBoundaries <Float> (minus, plus);
+
+            // cached powers are spaced by dtoapow128Step decimal exponents.
+            int mk = kComputation (plus._exponent + 64, -124) - dtoapow128Min;
+            int index = (mk + dtoapow128Step - 1) / dtoapow128Step;
+            const DiyFp128& c_mk = dtoapow128[index];
+
+            minus *= c_mk;
+            plus  *= c_mk;
+
+            ++minus._mantissa;
+            --plus._mantissa;
+
+            k = -(dtoapow128Min + (index * dtoapow128Step));
+
             digitsGen (val.normalize () * c_mk, plus, plus._mantissa - minus._mantissa, buffer, length, k);
         }
+
+        template <typename Float, typename CharT>
+        inline CharT* dtoa (CharT* buffer, Float value)
+        {
+            using Format = Wide <Float>;
+
+            __uint128_t bits = Format::toBits (value);
+            bool is_negative = (bits >> Format::_signShift) != 0;
+
+            *buffer = '-';
+            buffer += is_negative;
+
+            if ((bits & ~(static_cast <__uint128_t> (1) << Format::_signShift)) == 0)
+            {
+                return writeZero (buffer);
+            }
+
+            int length = 0, k = 0;
+            grisu2 (buffer, length, k, value);
+            return prettify (buffer, length, k);
+        }
+    #endif
     }
 
     /**
@@ -212,26 +696,254 @@ namespace dconv
      * @param value value to convert.
      * @return end position.
      */
+    DCONV_API char* dtoa (char* buffer, double value)
+#if defined(DCONV_DECLARE_ONLY)
+    ;
+#else
+    {
+        return details::dtoa (buffer, value);
+    }
+#endif
+
+    /**
+     * @brief double converted to its shortest digits, ready to be written.
+     *
+     * the length is known before writing, so that the output can be sized exactly
+     * and the digits generated once.
+     */
+    class PreparedDouble
+    {
+    public:
+        /**
+         * @brief generate the shortest digits of a value.
+         * @param value value to convert.
+         */
+        explicit PreparedDouble (double value) noexcept
+        {
+            uint64_t bits;
+            memcpy (&bits, &value, sizeof (double));
+            _negative = (bits >> 63) != 0;
+            value = _negative ? -value : value;
+
+            if (value != 0.0)
+            {
+                details::grisu2 (_digits, _length, _k, value);
+            }
+        }
+
+        /**
+         * @brief get the number of characters of the string representation.
+         * @return number of characters.
+         */
+        size_t size () const noexcept
+        {
+            return _negative + ((_length == 0) ? 3 : details::prettifyLength (_length, _k));
+        }
+
+        /**
+         * @brief write the string representation.
+         * @param buffer buffer to write the string representation to (exactly size () characters).
+         * @return end position.
+         */
+        char* write (char* buffer) const noexcept
+        {
+            *buffer = '-';
+            buffer += _negative;
+
+            if (_length == 0)
+            {
+                return details::writeZero (buffer);
+            }
+
+            return details::place (buffer, _digits, _length, _k);
+        }
+
+    private:
+        /// shortest digits.
+        char _digits[20];
+
+        /// number of digits (0 for zero).
+        int _length = 0;
+
+        /// decimal exponent of the last digit.
+        int _k = 0;
+
+        /// sign.
+        bool _negative = false;
+    };
+
+    /**
+     * @brief get the length of the string representation of a double.
+     * @param value value to convert.
+     * @return number of characters written by dtoa.
+     */
+    inline size_t dtoaLength (double value) noexcept
+    {
+        return PreparedDouble (value).size ();
+    }
+
+    /**
+     * @brief string representation notation.
+     */
+    enum Notation
+    {
+        NotationStandard,   /**< positional from 1e-6 to 1e21, ".0" on integers, exponent otherwise. */
+        NotationShortest,   /**< shortest text, integers without fractional part. */
+    };
+
+    /**
+     * @brief double to string conversion with the given notation.
+     *
+     * the notation is selected at compile time, NotationStandard being the same as dtoa.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    template <Notation notation>
     inline char* dtoa (char* buffer, double value)
     {
+        if (notation == NotationStandard)
+        {
+            return dtoa (buffer, value);
+        }
+
         uint64_t bits;
-        memcpy (&bits, &value, sizeof(double));
-        bool is_negative = (bits >> 63) != 0;
+        memcpy (&bits, &value, sizeof (double));
+        bool negative = (bits >> 63) != 0;
 
         *buffer = '-';
-        buffer += is_negative;
-        value = is_negative ? -value : value;
+        buffer += negative;
+        value = negative ? -value : value;
 
         if (value == 0.0)
         {
-            memcpy (buffer, "0.0", 3);
-            return buffer + 3;
+            *buffer = '0';
+            return buffer + 1;
+        }
+
+        char digits[20];
+        int length, k;
+        details::grisu2 (digits, length, k, value);
+
+        return details::placeShortest (buffer, digits, length, k);
+    }
+
+    /**
+     * @brief double to string conversion with a bounded relative error.
+     *
+     * the shortest decimal within half a unit of the given significant digit is printed, so that
+     * telemetry values need no more digits than their precision (never more digits than dtoa). close to
+     * the largest double, one more digit may be printed so that the output doesn't overflow.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @param significantDigits number of significant digits to keep (1 to 17).
+     * @return end position.
+     */
+    inline char* dtoaApprox (char* buffer, double value, int significantDigits)
+    {
+        if (significantDigits >= 17)
+        {
+            return dtoa (buffer, value);
         }
 
-        int length = 0, k = 0;
-        details::grisu2 (buffer, length, k, value);
-        return details::prettify (buffer, length, k);
+        uint64_t bits;
+        memcpy (&bits, &value, sizeof (double));
+        bool negative = (bits >> 63) != 0;
+
+        *buffer = '-';
+        buffer += negative;
+        value = negative ? -value : value;
+
+        if (value == 0.0)
+        {
+            return details::writeZero (buffer);
+        }
+
+        char digits[20];
+        int length, k;
+        details::grisu2Approx (digits, length, k, value, (significantDigits < 1) ? 1 : significantDigits);
+
+        return details::place (buffer, digits, length, k);
     }
+
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+    /**
+     * @brief long double to string conversion.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    inline char* dtoa (char* buffer, long double value)
+    {
+        return details::dtoa (buffer, value);
+    }
+#elif (LDBL_MANT_DIG == 53)
+    /**
+     * @brief long double to string conversion.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    inline char* dtoa (char* buffer, long double value)
+    {
+        return dtoa (buffer, static_cast <double> (value));
+    }
+#else
+    char* dtoa (char* buffer, long double value) = delete;
+#endif
+
+#if defined(DCONV_HAS_FLOAT128)
+    /**
+     * @brief __float128 to string conversion.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    inline char* dtoa (char* buffer, __float128 value)
+    {
+        return details::dtoa (buffer, value);
+    }
+#endif
+
+    /**
+     * @brief double to wide string conversion.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    template <typename CharT, typename = EnableIfWideChar <CharT>>
+    inline CharT* dtoa (CharT* buffer, double value)
+    {
+        return details::dtoa (buffer, value);
+    }
+
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+    /**
+     * @brief long double to wide string conversion.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    template <typename CharT, typename = EnableIfWideChar <CharT>>
+    inline CharT* dtoa (CharT* buffer, long double value)
+    {
+        return details::dtoa (buffer, value);
+    }
+#endif
+
+#if defined(DCONV_HAS_FLOAT128)
+    /**
+     * @brief __float128 to wide string conversion.
+     * @param buffer buffer to write the string representation to.
+     * @param value value to convert.
+     * @return end position.
+     */
+    template <typename CharT, typename = EnableIfWideChar <CharT>>
+    inline CharT* dtoa (CharT* buffer, __float128 value)
+    {
+        return details::dtoa (buffer, value);
+    }
+#endif
 }
 
 #endif
@@ -26,13 +26,17 @@
 #define __DCONV_DTOAPOW_HPP__
 
 // dconv.
+#include <dconv/config.hpp>
 #include <dconv/diyfp.hpp>
 
 namespace dconv
 {
     namespace details
     {
-        constexpr DiyFp dtoapow[] = {
+    #if defined(DCONV_DECLARE_ONLY)
+        extern const DiyFp dtoapow[687];
+    #else
+        DCONV_TABLE DiyFp dtoapow[] = {
             {0xbf29dcaba82fdeae, -1203}, {0xeef453d6923bd65a, -1200},
             {0x9558b4661b6565f8, -1196}, {0xbaaee17fa23ebf76, -1193},
             {0xe95a99df8ace6f54, -1190}, {0x91d8a02bb6c10594, -1186},
@@ -378,6 +382,7 @@ namespace dconv
             {0xdb68c2ca82ed2a06,  1069}, {0x892179be91d43a44,  1073},
             {0xab69d82e364948d4,  1076}
         };
+    #endif
     }
 }
 
@@ -0,0 +1,1292 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_DTOAPOW128_HPP__
+#define __DCONV_DTOAPOW128_HPP__
+
+// dconv.
+#include <dconv/config.hpp>
+#include <dconv/diyfp.hpp>
+
+#if defined(DCONV_HAS_INT128)
+namespace dconv
+{
+    namespace details
+    {
+        /// decimal exponent of the first cached power.
+        constexpr int dtoapow128Min = -4936;
+
+        /// decimal exponent distance between two cached powers.
+        constexpr int dtoapow128Step = 8;
+
+    #if defined(DCONV_DECLARE_ONLY)
+        extern const DiyFp128 dtoapow128[1239];
+    #else
+        DCONV_TABLE DiyFp128 dtoapow128[] = {
+            {0xf9813929d85ab98d, 0xa7ed572e14867e0e, -16525},
+            {0xb9e5428330737362, 0xbddb2dfde3f8a6e3, -16498},
+            {0x8a80c2f6de9daa7a, 0x73d870d39b65b2f6, -16471},
+            {0xce62b124fdc6b847, 0x926e0a55edac19de, -16445},
+            {0x99c4e9bfe1a87a6d, 0x4a4626c91ecb034b, -16418},
+            {0xe5224aa15f397d98, 0x29608b2d0accdac3, -16392},
+            {0xaab7d536dc82c556, 0x5a270f5db47d9a27, -16365},
+            {0xfe63c92c8d33b41e, 0xb5fbfab76d62f66c, -16339},
+            {0xbd89006346a9a34d, 0x88227fdfc13ab53e, -16312},
+            {0x8d36f6971766349c, 0xac63454249b771c8, -16285},
+            {0xd26d2210324bda0f, 0x6327b7b4f01924c2, -16259},
+            {0x9cc7a1baad7b41d5, 0x0a2637e82a0999c2, -16232},
+            {0xe99ec0788c206e1f, 0xbc6ce5a8495e08d9, -16206},
+            {0xae0f80a2a8960b10, 0x7aeb29f92abeb4cb, -16179},
+            {0x81af6a9d20a77f79, 0x1cb6dd3725f41393, -16152},
+            {0xc13efc51ade7df64, 0xe05fe4207ca3d508, -16126},
+            {0x8ffac1adca9803d1, 0xe8888dc7a0e13001, -16099},
+            {0xd68bd3c92066a797, 0x326cb526b3747638, -16073},
+            {0x9fd970b048391fd2, 0x1f689c9558410fb3, -16046},
+            {0xee31b2998a4af130, 0xeb31f1edd17f88ed, -16020},
+            {0xb177ecd353b85f54, 0xcca1e7a26a603b79, -15993},
+            {0x84396c05c0eebc9d, 0xfe110a64e32dd81b, -15966},
+            {0xc50791bd8dd72edb, 0x3c55f3f947fef0e9, -15940},
+            {0x92cc685aa8b19088, 0x05a381bcecff3f06, -15913},
+            {0xdabf2bd2f1a60182, 0x9448fe23ddb633b1, -15887},
+            {0xa2faa242a3bd093c, 0xc62364c260a887e2, -15860},
+            {0xf2db91b7e57dc04b, 0x09aebf155e28b966, -15834},
+            {0xb4f16dc0f196d9c0, 0xa0542f5c07760b47, -15807},
+            {0x86d0275ffab77e97, 0xbbac4d039b0a97fd, -15780},
+            {0xc8e31de056f89c19, 0x0915564d8ab057ee, -15754},
+            {0x95ac3012d5086d4c, 0x4aa3a2db98aa6c19, -15727},
+            {0xdf0791ad9be61bdf, 0xe22b98be11dc18ef, -15701},
+            {0xa62b838ec768f929, 0x65c26fa6afee3a5f, -15674},
+            {0xf79cd0bc0a9865e1, 0xa6246cc005e1b087, -15648},
+            {0xb87c5908740c64db, 0x57c1403aeef9d37e, -15621},
+            {0x8973dc7533777a76, 0x68d14a8f10ac484e, -15594},
+            {0xccd1ffc6bba63e21, 0x801e38463183fc89, -15568},
+            {0x989a5fa7953007a7, 0x4574b3f93355188c, -15541},
+            {0xe3656edfd7804f33, 0x8ab10feb6b340240, -15515},
+            {0xa96c63343c2f77f2, 0x74afb52e8c70c144, -15488},
+            {0xfc75e4ce56dbeacf, 0xef4cd02f22214799, -15462},
+            {0xbc1905f3e898cca2, 0x41a8bcd577f7a7d8, -15435},
+            {0x8c24cc4e867eb529, 0xcd77bc4633689771, -15408},
+            {0xd0d49859d60d40a3, 0xcfadf6b2aa7c4f44, -15382},
+            {0x9b973f4d21e24276, 0xb4841acf8493cb6e, -15355},
+            {0xe7d92f014768e772, 0x62eae6f47049fc2f, -15329},
+            {0xacbd915c9dd075bd, 0xfa59484863b7ed8a, -15302},
+            {0x80b3a2b12f503033, 0x8609dc81f834c9d6, -15275},
+            {0xbfc7cd82df24d127, 0x52b0634f4273672f, -15249},
+            {0x8ee3393b07698e29, 0x62648d93cdf05ba3, -15222},
+            {0xd4eb4a687c0253e8, 0x9e601e707a2c3488, -15196},
+            {0x9ea318a19a11db7c, 0x8edcb8f9d91496b9, -15169},
+            {0xec633fc4d435328b, 0xb9e09a79bb6fdc3d, -15143},
+            {0xb01f5fc35203ed1b, 0x78e2aad3ddd1e309, -15116},
+            {0x8338b62136478f1d, 0x0188705b0793285e, -15089},
+            {0xc3890a72fae23f1b, 0x24a8078e410851f3, -15063},
+            {0x91af66d623f28858, 0xc507059621adb710, -15036},
+            {0xd9167ab0c1965798, 0xa8edffdccfe4db4c, -15010},
+            {0xa1be36b418d1d79e, 0x6c6fc7cb887020d0, -14983},
+            {0xf10411033b08f678, 0x4f8ccbdb8369b781, -14957},
+            {0xb39221bd665068e3, 0x6a33f4a43a386842, -14930},
+            {0x85ca6acd9d3e7daf, 0xdcf0fb000a652614, -14903},
+            {0xc75d1948ae1b1da9, 0x45ae2dc0f63d6baf, -14877},
+            {0x94899a0e25c111b0, 0xcdbb9a94962e89cf, -14850},
+            {0xdd568fe9ab559344, 0xb17cd86e7fcece75, -14824},
+            {0xa4e8e60beec08b8f, 0xd49596808f0f2915, -14797},
+            {0xf5bc14c5d16f75a6, 0x9db23c4146ccc303, -14771},
+            {0xb7162c41954f4159, 0xfe1aeb52fa041ff5, -14744},
+            {0x88690003f282ab5e, 0xb0d9d62fc3e90a00, -14717},
+            {0xcb44585821c722ec, 0xec6ec617f2819a18, -14691},
+            {0x9772192ad4d59e62, 0x61d575ed185545db, -14664},
+            {0xe1abf2cd11206610, 0x1151250681d59706, -14638},
+            {0xa82374afffa841ae, 0xed68f33c29c4af2c, -14611},
+            {0xfa8bbf517f29408a, 0x31c0368ccb2c5758, -14585},
+            {0xbaabd5f074243017, 0x1e7a77dc9501b6c9, -14558},
+            {0x8b14b64f0d8634c8, 0xff9c2ab50b90458b, -14531},
+            {0xcf3f27ce49c2d6d9, 0x6fd57caa81c06605, -14505},
+            {0x9a692bd43b368fc3, 0x8389c148c919653b, -14478},
+            {0xe6170e21b2910457, 0x025a8e1e5dbb41d6, -14452},
+            {0xab6e322e450afa09, 0xe42fd04639a19c19, -14425},
+            {0xff738731eefd4488, 0xabc0986e18c2177a, -14399},
+            {0xbe53771cc8f1b8bb, 0x6c682809ba47ff0e, -14372},
+            {0x8dcdcf7d452a91bc, 0xfb3057c1a4677375, -14345},
+            {0xd34de9ba26881825, 0x36dbf0106a63706d, -14319},
+            {0x9d6f1b198a8492ae, 0x5d102c8bf905fbc4, -14292},
+            {0xea984ec57de69f13, 0x66e849253e5da0c2, -14266},
+            {0xaec96fa376524f2a, 0x0c8265bc64c7f1de, -14239},
+            {0x8239f2a27bd069fd, 0xa20f38d4d5ddf4f1, -14212},
+            {0xc20d69d40b17d664, 0x4394073b3444cb0d, -14186},
+            {0x90948ea6c52e5802, 0xd6960685c12cd7c2, -14159},
+            {0xd7710216354c1801, 0x10b293ada0d3ba6c, -14133},
+            {0xa08431782420645b, 0xee2ceed5a354f3f3, -14106},
+            {0xef3023b80a732d93, 0xf5a7800f23ef67b8, -14080},
+            {0xb2357fc2d76029b7, 0xaead36c237cbf749, -14053},
+            {0x84c6aa631ee7e480, 0xfbbfcbae02e2a24b, -14026},
+            {0xc5da09e70e0e6381, 0x0c42b2f966c8267f, -14000},
+            {0x936938340359e22c, 0xa64ea358dfcf3467, -13973},
+            {0xdba8d6d20f6b5894, 0xf0fc278b7f968212, -13947},
+            {0xa3a8bae2c48f4081, 0x034ebca61814d704, -13920},
+            {0xf3defe25478e074a, 0x0e85fc7f4edbd3cb, -13894},
+            {0xb5b2b6de2e409ea8, 0x12135d9ca994fa7b, -13867},
+            {0x876029ad8859b2fd, 0x54aca7f5709cb082, -13840},
+            {0xc9b9b4f2d7b0cb85, 0x5a83fc122da3584c, -13814},
+            {0x964c11e45509f7d8, 0x888d19531abb0531, -13787},
+            {0xdff5cfdc3a10c7cb, 0xeeb022f7d411a514, -13761},
+            {0xa6dd04c8d2ce9fde, 0x2de38123a1c3cffc, -13734},
+            {0xf8a551706112897c, 0x4268a54f70bd28c5, -13708},
+            {0xb9416aede0c117c9, 0x81b9f7d770ad1d44, -13681},
+            {0x8a06b08f40de198d, 0x293c7abb26d228ef, -13654},
+            {0xcdacca69a2d4c45a, 0x96eda1512f2fc324, -13628},
+            {0x993d62d4a5bab256, 0x0716871a6cce3fce, -13601},
+            {0xe458572c2709b45c, 0x4d755b674a1890d7, -13575},
+            {0xaa215e1dd44b63de, 0x2bd185b474458ecd, -13548},
+            {0xfd83933eda772c0b, 0x5052e9289f0f2333, -13522},
+            {0xbce1f3993ab4bd83, 0xa36deff9bd071f20, -13495},
+            {0x8cba8056dc8c68b9, 0x77a8114553b151f5, -13468},
+            {0xd1b3ab9c0f0a10d0, 0x383396664a5f7705, -13442},
+            {0x9c3d73864f3805c0, 0x24b99688d11e41bd, -13415},
+            {0xe8d0d8cc67bd169f, 0xaa29753694fe424d, -13389},
+            {0xad7617610634129e, 0xc05fb0b5c550f28d, -13362},
+            {0x813d1dc1f0c754d6, 0x01b02378a405b421, -13335},
+            {0xc094aa3eddb202e4, 0x1a096fc7358788c3, -13309},
+            {0x8f7bdb9a43fcc895, 0xab32a3251dfecdba, -13282},
+            {0xd5cebbc27e65a603, 0xf81807575fd38f1e, -13256},
+            {0x9f4c8de6141c93a9, 0x91cc861b3e344f90, -13229},
+            {0xed5fc2e513417a2f, 0xba641fe889dfd27c, -13203},
+            {0xb0db82a51ce15f2d, 0x56a9288289166fd2, -13176},
+            {0x83c4e245ed051dc1, 0xb782db1fc6aba49b, -13149},
+            {0xc459e9fd5b1932f0, 0x885c3355b85a861b, -13123},
+            {0x924b063d1ceb45b3, 0x1436a2dad831490e, -13096},
+            {0xd9fe6006a23efc3f, 0x02738f09b30d66e0, -13070},
+            {0xa26afd533d4ab9bf, 0xe19f7154afe4a693, -13043},
+            {0xf20585c66091c0cc, 0x532c06d005ceeb11, -13017},
+            {0xb451f3982a13e433, 0x73e14bc8e5edd725, -12990},
+            {0x86595584116caf3c, 0x4250be2eeba87d15, -12963},
+            {0xc8320fbbf937f019, 0xfec051792a43f40d, -12937},
+            {0x9528457752fa086e, 0x9c2d118bcc889e52, -12910},
+            {0xde42ff8d37cad87f, 0x1463ef488d5226cc, -12884},
+            {0xa5990ea6db0f2c9e, 0xa98507881013d2ca, -12857},
+            {0xf6c293f375e5fb48, 0xd7d21cf249970e06, -12831},
+            {0xb7d9bf8baac9b421, 0x59158ac3582a708a, -12804},
+            {0x88fab70d8b44952a, 0x3f1f93f1943ca9b6, -12777},
+            {0xcc1d7a33a461bcf6, 0xf10a25c3c7d82a13, -12751},
+            {0x9813dfdbc133b692, 0x43dd699c4ed1aaf4, -12724},
+            {0xe29d037ff5837742, 0x3134e6ee7cfa116a, -12698},
+            {0xa8d7103b2a9fddbf, 0x2409ac6534c33030, -12671},
+            {0xfb97622d6e3ab29d, 0x61ab131dda108768, -12645},
+            {0xbb733d7cbd723173, 0x50645e07942823e4, -12618},
+            {0x8ba947b223e5783e, 0x2c87f18b39478aa3, -12591},
+            {0xd01c89f80cd9e07e, 0x437abd5769e5212f, -12565},
+            {0x9b0e1d5efcf22639, 0xcede6f194474c022, -12538},
+            {0xe70cd717aa52b3a2, 0x7d8877544a8029ca, -12512},
+            {0xac2551f320ad6b58, 0xdaf3c879401c5e73, -12485},
+            {0x804233bf4b0b191c, 0x752cd52fafaf4af2, -12458},
+            {0xbf1ec61c814a8455, 0xe601c3971c1e28a1, -12432},
+            {0x8e6549867da7d11a, 0x4054f5360249ebd1, -12405},
+            {0xd42fa180f26f4848, 0x0a5328d99006972f, -12379},
+            {0x9e17475e42d0bfac, 0x759a4eadddc5db0d, -12352},
+            {0xeb92e7a68f778fd1, 0xb3c8e4d4383ae332, -12326},
+            {0xaf84254219c0ea7a, 0x336957d6aa2f86e6, -12299},
+            {0x82c50ea2f0505aeb, 0x013536fafeef164b, -12272},
+            {0xc2dcb3d89fb0f90e, 0x75af8412a0d013fd, -12246},
+            {0x912effea7015b2c5, 0xc1187fa0c18adbbe, -12219},
+            {0xd85725339eaf7141, 0x89c569b4334e9284, -12193},
+            {0xa12fa8a6865532bb, 0xbe89e2a60ba084db, -12166},
+            {0xf02fa4a2ce256606, 0x7f437695d5ccdbe1, -12140},
+            {0xb2f3dd33b1237ef4, 0x6bfa5776b989c85c, -12113},
+            {0x85547fa14b14e46f, 0x1381a641a3d35b14, -12086},
+            {0xc6ad62e400419c89, 0x9d34de160926c295, -12060},
+            {0x9406af8f83fd6265, 0x4b4de34e0ebc3e06, -12033},
+            {0xdc937b6c8e99db36, 0x39278aa13158943b, -12007},
+            {0xa4578d7ba4fc7b82, 0x75a419126254213c, -11980},
+            {0xf4e37fb139e0036a, 0x2d1cfba52339e57b, -11954},
+            {0xb674ce73bf10ea47, 0x4fe1e9b0fcdf7b3d, -11927},
+            {0x87f0c5d01e9d562f, 0x16f13f5536ddb132, -11900},
+            {0xca91313fa8928aab, 0xd0c39213d26ef65a, -11874},
+            {0x96ec9e7f9004839b, 0xac73f0226eff5ea1, -11847},
+            {0xe0e50c894cc21dfd, 0x81884dd8cb5eb34a, -11821},
+            {0xa78f439fbd5d9a68, 0x700dfa111be0bc09, -11794},
+            {0xf9aeecb0409d0205, 0x36536fbc2d06d029, -11768},
+            {0xba074f567efa02e0, 0xfa6678fe2593a520, -11741},
+            {0x8a9a21815fad9d9c, 0x576c105a49a6f1ae, -11714},
+            {0xce887ec3c86a94de, 0xf6cbe4d90e068e5a, -11688},
+            {0x99e11423765ec1d0, 0x2184706ea46a4c38, -11661},
+            {0xe54c42f27cd36075, 0x4be5d9ca7aaaee5e, -11635},
+            {0xaad71a5aab16dc6c, 0x5086fdecf2f641c6, -11608},
+            {0xfe9261c311b7e38a, 0x3db9bb526c25a011, -11582},
+            {0xbdabb7e0de9fe022, 0xafc67523f435a5f3, -11555},
+            {0x8d50d449655a4196, 0x53f2b6a7844ba717, -11528},
+            {0xd293ad28f3512f42, 0x09cd28999c147c36, -11502},
+            {0x9ce4594a044e0f1b, 0xddadb80577b906be, -11475},
+            {0xe9c98b26196cb227, 0x11c26bb9d3bfdbb2, -11449},
+            {0xae2f6281a83e1b39, 0x6a2438f35517206b, -11422},
+            {0x81c72bae7e65dad8, 0x5e580222f2f811ae, -11395},
+            {0xc16261d0f6d4760c, 0x108b4c050485d357, -11369},
+            {0x9015210538e1127e, 0x33e50ac8f68b45b2, -11342},
+            {0xd6b32011885af03e, 0xc303c16367d315a6, -11316},
+            {0x9ff6b82ef415d222, 0x60dbd8aa443b560f, -11289},
+            {0xee5d53c1e552a0fd, 0x1ecd30b9ed86dbf4, -11263},
+            {0xb1986e7f150ff8d4, 0x6ade8cb36cebc3fa, -11236},
+            {0x8451a42684c5350a, 0x626a353850316635, -11209},
+            {0xc52ba8a6aeb15d92, 0x9e98cb984f0d3051, -11183},
+            {0x92e74be10524c389, 0xb5143323a7f8e16d, -11156},
+            {0xdae73d13491a6188, 0xcbee5ed9167d0e27, -11130},
+            {0xa3187c82120dace6, 0x7401c6f091f87727, -11103},
+            {0xf3080d8e10f7553f, 0x71e6a2e9bbbf5a4b, -11077},
+            {0xb512925a669dc906, 0x9bc8c085f15b1d02, -11050},
+            {0x86e8d8e4e4d7c3e6, 0x419a39c9e38f9c9c, -11023},
+            {0xc907e9ac8a199ce7, 0x748ad8b31cc1e04a, -10997},
+            {0x95c79a5ea669fe86, 0x3615915d6df76670, -10970},
+            {0xdf306bc120a16b17, 0x8d0900f994cc1aea, -10944},
+            {0xa649f36e8583e81a, 0x4d5b32f713d7f477, -10917},
+            {0xf7ca2b88155f87a4, 0xeb7b90f069177906, -10891},
+            {0xb89e23c03d3d9b7f, 0xf4d741c050aaa632, -10864},
+            {0x898d09beb318ba4e, 0xdd1f8f7bed51eec0, -10837},
+            {0xccf78400a45f6da4, 0xe2a3569e96292a11, -10811},
+            {0x98b6535c5af79e00, 0xd3004691babca639, -10784},
+            {0xe38f15b51b8440f7, 0x31ea85e808deba7f, -10758},
+            {0xa98b6ba23e2300c7, 0xb4b39dd9ddb8d317, -10731},
+            {0xfca422edc56fc81a, 0x55bdf34c2492783b, -10705},
+            {0xbc3b7a0aa383ad48, 0x77fd3cc8ed79155e, -10678},
+            {0x8c3e77c8f46d23bf, 0x7fef20156b676077, -10651},
+            {0xd0fad89dd7eb3e78, 0x0c1abad2b2e88de0, -10625},
+            {0x9bb3bf1b953ee41c, 0x60f3bbcceade5271, -10598},
+            {0xe803a69a91d37448, 0xe29f48fcf08e33a1, -10572},
+            {0xacdd3555869159d1, 0xec41c1793d69d0d1, -10545},
+            {0x80cb35a44b596439, 0xeebc8b6a48ccca5e, -10518},
+            {0xbfeaee4976906ee7, 0x8c84ff8dab057b60, -10492},
+            {0x8efd655ee1bb7333, 0x5a32d8e770e95ef8, -10465},
+            {0xd5124a6513c582c0, 0x4a1ccb32d5c21bf6, -10439},
+            {0x9ec02747f033be8f, 0x6c8fd5388d616606, -10412},
+            {0xec8e8c38840796e9, 0xb770cee5123a5dd7, -10386},
+            {0xb03fa252bd05a815, 0x3ca5a7540d9d56c9, -10359},
+            {0x8350bf3c91575a87, 0xe79e236bf8bf47a9, -10332},
+            {0xc3acdb4af8824704, 0x8a0ce6bfd4ac4580, -10306},
+            {0x91ca16284ae88f71, 0xceab85fd719004ad, -10279},
+            {0xd93e3e26dfe94d39, 0xc1ca9a7be24feedc, -10253},
+            {0xa1dbd6fe468072a2, 0xbde5e7aab8410245, -10226},
+            {0xf130367c2bddc872, 0x0d90dd072629ccea, -10200},
+            {0xb3b305fe328e571f, 0x92e1bc1fbb33f18d, -10173},
+            {0x85e2ec6170f28b83, 0x351759c1ebc1fed3, -10146},
+            {0xc7819da48dde4790, 0x4e6570cd8536b620, -10120},
+            {0x94a4cf2019d7ba15, 0x711ae6040de62000, -10093},
+            {0xdd7f1aad114a3387, 0x11e76936941704f9, -10067},
+            {0xa5071ad3ed4366e5, 0x5cebc844b324a91b, -10040},
+            {0xf5e91783c229830c, 0x7087cecf10e2b5a6, -10014},
+            {0xb737b55e31cdde04, 0xa908fd4a88728b6b, -9987},
+            {0x8881fc6c10cf2430, 0x3ca163b873aa88a6, -9960},
+            {0xcb6993bba6c72e28, 0x89e4ac389b89223a, -9934},
+            {0x978dd69af60dc360, 0xe1e20cfd1289138d, -9907},
+            {0xe1d548c4ae7c8fbe, 0x366f87c33e75f6fc, -9881},
+            {0xa84240de13092bf8, 0x4e0e87788cb5d3bf, -9854},
+            {0xfab9a3a97aa5177f, 0x738e49f18bcab48d, -9828},
+            {0xbace07232df1c802, 0x7c4c65d15c614c56, -9801},
+            {0x8b2e2ff31ad395be, 0xf3144b35b50a39a8, -9774},
+            {0xcf651dced4de3fc0, 0x46b6e237426a81dd, -9748},
+            {0x9a85744e099b2123, 0x4da7b30a0026bae7, -9721},
+            {0xe641334805f3e36f, 0xdb67cf7bbbac365b, -9695},
+            {0xab8d98b943b862a6, 0x876a27a72e171a45, -9668},
+            {0xffa2518eb6cf7a2e, 0x2e4218a0efdfc872, -9642},
+            {0xbe7653b01aae13e5, 0xef84cc99cb4c5d18, -9615},
+            {0x8de7c8d0f396cdf1, 0x071d3350ff673296, -9588},
+            {0xd3749dff0eaddc15, 0xf40e0cd6e6e88e82, -9562},
+            {0x9d8bf155e7f3b2db, 0xa6c4665aaecd096a, -9535},
+            {0xeac34728f6cfe569, 0xaadf62160a3fc2d3, -9509},
+            {0xaee973911228abca, 0xe3187c34500d9ab4, -9482},
+            {0x8251cd13b875a7a3, 0xd3044e8d195b6cd1, -9455},
+            {0xc230f522ee0a7fc2, 0xcfc147ade4843a24, -9429},
+            {0x90af0a2a10f6f849, 0xb93a5f1bdc43b0d2, -9402},
+            {0xd798785921820787, 0xd94d2137a3a6f4f5, -9376},
+            {0xa0a1983d975e4144, 0x9bfbce7554790cde, -9349},
+            {0xef5bf37b6d35a129, 0x44a0074c59551603, -9323},
+            {0xb2562427e8216ea5, 0xaf62538407484bfd, -9296},
+            {0x84defc62f01c45b0, 0x67ac7c1d9ccd8267, -9269},
+            {0xc5fe475d4cd35cff, 0x4668677d5f46c29c, -9243},
+            {0x938438737074f3d8, 0x2d591a4819b8284f, -9216},
+            {0xdbd112df5297a1d8, 0x45c8e937e6a528bf, -9190},
+            {0xa3c6b505bda91bcc, 0x52d9655bdf62f25c, -9163},
+            {0xf40ba9801337050e, 0x6607767797ddf0ee, -9137},
+            {0xb5d3fedefd80f48f, 0x46ee4428b15932c9, -9110},
+            {0x8778f5932bc3bfe6, 0x0e6ed66e0a07875e, -9083},
+            {0xc9dea80d6283a34c, 0x474b3cb1fe1d6a80, -9057},
+            {0x966799792df3b82e, 0xfd57bb3614e6b269, -9030},
+            {0xe01ed593308f8ed9, 0x331e12152d42a8e3, -9004},
+            {0xa6fb952bf0d49b84, 0x0d4d01e4c1675bf5, -8977},
+            {0xf8d2dcaf37504b51, 0x9492db3d978aaca8, -8951},
+            {0xb96359be77501dc7, 0xe5984d23131be8ed, -8924},
+            {0x8a1ff8bdafa4e3da, 0x3eeca1cbb79521c2, -8897},
+            {0xcdd276b6e582284f, 0xd6ea3b733029ef0c, -8871},
+            {0x995974653b7e0231, 0x212da7006dc4e43b, -8844},
+            {0xe4822a7f9617bb33, 0xa5f4c73d55519769, -8818},
+            {0xaa4087b22c67c920, 0xc68000606f44e0f5, -8791},
+            {0xfdb202c3e987d216, 0x0111be2fb2e5c6e7, -8765},
+            {0xbd048c7daf8acadb, 0x9736b4514993e0ba, -8738},
+            {0x8cd4473d0625a26d, 0x4cd918e796d7f296, -8711},
+            {0xd1da14bc489025ea, 0x3736730a9e47fef9, -8685},
+            {0x9c5a11c63ab7cf11, 0xb1b83c452ba6ffe5, -8658},
+            {0xe8fb7dc2dec0a404, 0x598eec7d41754c09, -8632},
+            {0xad95dd266c26eb0b, 0xc22a63ac8020c8c1, -8605},
+            {0x8154c9e3a8211c8c, 0x341f8560863bfd17, -8578},
+            {0xc0b7f08ba669010a, 0x526e654f0e5e5559, -8552},
+            {0x8f9623b34a2198af, 0x8ce3c290df62726b, -8525},
+            {0xd5f5e5681a4b9285, 0x3d24e68dc1027247, -8499},
+            {0x9f69bb9678a46987, 0xef8af1db222b46bd, -8472},
+            {0xed8b3d994efadc49, 0xe19c0ef73d09351b, -8446},
+            {0xb0fbe7aa6ce75997, 0xf73cbde9febc8fce, -8419},
+            {0x83dd050e1af0fc01, 0x804ba476baa4450c, -8392},
+            {0xc47de1179df8cec0, 0x9ba5174cb48ba66d, -8366},
+            {0x9265d21090b99fe9, 0xe2cee7fcad3dd2a4, -8339},
+            {0xda264df693ac3e30, 0x742ab8f3864562c9, -8313},
+            {0xa288bd430c6d1b1b, 0x29931329e79c8b0e, -8286},
+            {0xf231da67b03cf797, 0x68622adb1e23063c, -8260},
+            {0xb472fafb943fa28f, 0xd19c70f25ea3841e, -8233},
+            {0x8671f14568278bea, 0x138204ea625927f8, -8206},
+            {0xc856bb19e0dd07ce, 0xd7bc2b23a37762dc, -8180},
+            {0x9543979973486a38, 0xe0fdf12ba6e31b7b, -8153},
+            {0xde6bb59f56672cda, 0x8c119f3680212414, -8127},
+            {0xa5b763b319d7f1dc, 0x0a0f429d93058121, -8100},
+            {0xf6efc6c6225746a3, 0xd6946fcf8e538085, -8074},
+            {0xb7fb6c7affd6c2d0, 0x62683ad0b608707f, -8047},
+            {0x8913ce2661c4a648, 0x926bac7f1fba0872, -8020},
+            {0xcc42dd5cb5091819, 0x1d8106ccf8ee85b4, -7994},
+            {0x982fbaedba1d4931, 0x795a917d40217584, -7967},
+            {0xe2c6859f5c284230, 0x43190b523f872b9d, -7941},
+            {0xa8f5fd4f38217a35, 0x7583e52e7cf74193, -7914},
+            {0xfbc5778b22fff09b, 0x3781bf4a97122fbd, -7888},
+            {0xbb959335bd190ce7, 0xe34276320ecfc3ab, -7861},
+            {0x8bc2dc8cb0362d9c, 0xb69334f0428755a7, -7834},
+            {0xd042a8857b566755, 0x2895d86f30deaa8b, -7808},
+            {0x9b2a840f28a1638f, 0xe393a9c032fb0c34, -7781},
+            {0xe7372943179706fc, 0x2a0969bf88679396, -7755},
+            {0xac44da08fdefcd0b, 0x294160a6fd1cfca7, -7728},
+            {0x8059b1eb66539606, 0xd67236e716924471, -7701},
+            {0xbf41c7ed2a1d370b, 0x65de36dc36a40a11, -7675},
+            {0x8e7f5e99106a4192, 0x88db28a3812166c5, -7648},
+            {0xd4567f1dfcd41980, 0x62c2f46d2dfc1de3, -7622},
+            {0x9e343c686b8ed64a, 0x86c544ece6dc8914, -7595},
+            {0xebbe0df0c8201ac5, 0x131565be33dda91a, -7569},
+            {0xafa44b62b318e475, 0xf03c879c8ee460c5, -7542},
+            {0x82dd028f26d4563a, 0x6b78172159fa0166, -7515},
+            {0xc300651f80880192, 0x72e2b595805397c4, -7489},
+            {0x914997b7b12b451c, 0xd902ef9ea5baf811, -7462},
+            {0xd87ec59de6b65e6f, 0x25c64e402aec9c45, -7436},
+            {0xa14d2ed429e484da, 0xa376d06de0c3271b, -7409},
+            {0xf05ba3330181c750, 0xccfb1cc2ef1f44df, -7383},
+            {0xb314a47728f9cd6c, 0x9063016130392df8, -7356},
+            {0x856ceb9bcc7a6308, 0xa89115c785560023, -7329},
+            {0xc6d1c7108b40f1e0, 0xe7b11b906c695fda, -7303},
+            {0x9421cca6b062889e, 0xab5bb57b91f7e013, -7276},
+            {0xdcbbe27475ceff9c, 0xd18f7aece789392b, -7250},
+            {0xa475a7a43944b473, 0xfaa5fccc092f7e25, -7223},
+            {0xf5105ac3681f2716, 0x5f8385b3a882ff4c, -7197},
+            {0xb6963a01ba2002e7, 0x34348dc1f7b76ebf, -7170},
+            {0x8809ac32a8a8a8ed, 0xbae63e54a2044dde, -7143},
+            {0xcab64bd287cebca3, 0x28d3b56abc618269, -7117},
+            {0x9708437cb8e17ccd, 0x77b38138e8e00df2, -7090},
+            {0xe10e3e12527d6ea8, 0xaaa9a1632590d7ff, -7064},
+            {0xa7adf4a8f66ff68e, 0x205c4faf4edd7b60, -7037},
+            {0xf9dca895a3226409, 0x166c15f456786c27, -7011},
+            {0xba296266720a07e4, 0x81d1d278fa5b6b84, -6984},
+            {0x8ab384b1782bff7a, 0xa525a08694f6d43a, -6957},
+            {0xceae534f34362de4, 0x492512d4f2ead2cc, -6931},
+            {0x99fd43afc154745f, 0xe7abc45883074b43, -6904},
+            {0xe57642f39e09411e, 0x65d735a6b5956730, -6878},
+            {0xaaf66538c29160e1, 0x8a0c509807e71300, -6851},
+            {0xfec102e2857bc1f9, 0x6c656c3b1f2c9d92, -6825},
+            {0xbdce75ba5dc83189, 0x09de0e5c0a15659c, -6798},
+            {0x8d6ab6b8952ebf81, 0x1c272ef69cdeca63, -6771},
+            {0xd2ba3f510a3aa638, 0x9b4bca4cd6cec2dc, -6745},
+            {0x9d01161bed052bb7, 0x699b5f371124cf50, -6718},
+            {0xe9f45daa325ec7bd, 0xc11397f06e219614, -6692},
+            {0xae4f4a37a6149c25, 0x5d9e0d4a794bdbd1, -6665},
+            {0x81def119b76837c8, 0xfa70b9a2ca60b004, -6638},
+            {0xc185cdcc064a81ba, 0x50e167ba79e975e1, -6612},
+            {0x902f853148396bc8, 0xdd11faa0c0641c2d, -6585},
+            {0xd6da738ca8e3a262, 0xd21d99b338575cf5, -6559},
+            {0xa014050a8f168ecd, 0x0cd0a01396a49e31, -6532},
+            {0xee88fce8152a48df, 0xbfe3c33c58668242, -6506},
+            {0xb1b8f61f19c1efc8, 0xddd7ee26a2548b02, -6479},
+            {0x8469e0b6f2b8bd9b, 0x6a22490e8e9ec98c, -6452},
+            {0xc54fc62c152c7577, 0x5d35a1557b58d00b, -6426},
+            {0x9302345438dc0e7a, 0x69852cc6a07d2f0c, -6399},
+            {0xdb0f55aa6d2f36e9, 0xfc0b4471e52731d3, -6373},
+            {0xa3365c3950e68713, 0xe3c2b49434459c68, -6346},
+            {0xf334918a1f535751, 0x8d1082f5e4692779, -6320},
+            {0xb533bd05f6e01fed, 0x11800af4bc788512, -6293},
+            {0x87018eefb53c6325, 0x69138459b0fa72d4, -6266},
+            {0xc92cbc3624d3c12c, 0x3fb4a76467861e8a, -6240},
+            {0x95e309affe9ef97b, 0x2bec64de077e1e1a, -6213},
+            {0xdf594d503addf379, 0x007a33e8d271b7ca, -6187},
+            {0xa66868e17c45fd0e, 0x59a62c5431a80c39, -6160},
+            {0xf7f78ea2d9dec97e, 0x7969ec47a0736d61, -6134},
+            {0xb8bff4a88f1fb463, 0xb02d9653eb387401, -6107},
+            {0x89a63ba4c497b50e, 0x6c83ad1260ff20f5, -6080},
+            {0xcd1d0f19bcbb20b9, 0x4386716e663dc3e3, -6054},
+            {0x98d24c2fd2dcb34c, 0xec42875c0b22b986, -6027},
+            {0xe3b8c42b76494304, 0xb480fdb4118ee92d, -6001},
+            {0xa9aa79bf6a3aac53, 0xddcce19614fb7834, -5974},
+            {0xfcd269859142f888, 0x437edb3953f99d05, -5948},
+            {0xbc5df470ed1713cc, 0x053ac04d65d41858, -5921},
+            {0x8c5827f711735b46, 0xd82ef2860273de8e, -5894},
+            {0xd1211fe37ac6a148, 0x0fc4eafedd191926, -5868},
+            {0x9bd04422642a04ea, 0xc0c8bcfe58a2dabc, -5841},
+            {0xe82e25fb303a160e, 0x302fcf9150638209, -5815},
+            {0xacfcdf1a1701ed0d, 0xfcf0a53042530da3, -5788},
+            {0x80e2cce8d01f963a, 0xb5a21af135506167, -5761},
+            {0xc00e157f3e1ac56b, 0xb166137e2425ebf8, -5735},
+            {0x8f17964dfc3961f2, 0x416d7f9ab1e67580, -5708},
+            {0xd53951866a8320b9, 0xcd6b32986b2e0d61, -5682},
+            {0x9edd3b40cbf457e6, 0x52ffa3f3adcdf125, -5655},
+            {0xecb9e09a84ba7458, 0x1376f3966ce1e3e1, -5629},
+            {0xb05feacadc0f2bde, 0x1dab969365ba6aa1, -5602},
+            {0x8368ccbef9a63934, 0xf69ee7796c917cc1, -5575},
+            {0xc3d0b2b266412778, 0x322b56a3f15dc602, -5549},
+            {0x91e4ca5db93dbfec, 0x56700866b85d57ff, -5522},
+            {0xd96608e58b3729e4, 0x236856a0d2a305ce, -5496},
+            {0xa1f97cb5a701df00, 0xfb0df5580543c85c, -5469},
+            {0xf15c640b2de17b85, 0x75d9b3727e6e5a48, -5443},
+            {0xb3d3f04550c470ff, 0xf2eacdc9f8590fd9, -5416},
+            {0x85fb727262e1c639, 0x8060a788605dba36, -5389},
+            {0xc7a628b0bf64f690, 0xf09266bca93ac229, -5363},
+            {0x94c0092dd4ef9511, 0x43cf71d5c4fd7868, -5336},
+            {0xdda7acdd85afd664, 0x7747d69c5ed70443, -5310},
+            {0xa525552451825ef5, 0xfd1b78f2a40cc6ec, -5283},
+            {0xf61622804b9e50d1, 0x34be0728ae20930d, -5257},
+            {0xb759449f52a711b2, 0x68e1eb75340122d4, -5230},
+            {0x889afd67ccec9c28, 0x4b12ffc62419af2f, -5203},
+            {0xcb8ed5f103fe268c, 0x51a88a56888caeca, -5177},
+            {0x97a9991fd8b3afc0, 0x387898a6e22f821c, -5150},
+            {0xe1fea64e92b8f6f8, 0x621601d613047374, -5124},
+            {0xa86112b04762d978, 0xd61369c8fb8e0755, -5097},
+            {0xfae79069618ba5d7, 0x7d9d730e8f0a8a61, -5071},
+            {0xbaf03e9935d673d5, 0x2e360ab8fb3cb053, -5044},
+            {0x8b47ae41b64bda30, 0x1754b16beba6aad7, -5017},
+            {0xcf8b1ac366acc4da, 0xcfd00195f4a87d4b, -4991},
+            {0x9aa1c1f6110c0dd0, 0x8f8857e875e7774f, -4964},
+            {0xe66b602693347278, 0xe2d556a0426ade8a, -4938},
+            {0xabad0504a999d9e0, 0x5770075139d01ff3, -4911},
+            {0xffd1247d8bdaa3c7, 0x79c2cd4352f22790, -4885},
+            {0xbe9936a61e8eab99, 0xa754ee9f0ea90d90, -4858},
+            {0x8e01c6e6938117f3, 0xe47b2063e7841e0c, -4831},
+            {0xd39b595ad755ea09, 0x7b5b520aa67d2087, -4805},
+            {0x9da8ccda75b341b5, 0xa5c58d5f91a476d8, -4778},
+            {0xeaee476b5ac9923e, 0xf54a2172e3e5ee60, -4752},
+            {0xaf097d5be925b1eb, 0x529105ed19b26043, -4725},
+            {0x8269abe37634aee0, 0x0655af3873eee5a7, -4698},
+            {0xc25486f48484ae82, 0x8e287f8692cf00c1, -4672},
+            {0x90c98a8726ca5b85, 0xa332c62897ba44ed, -4645},
+            {0xd7bff5d676b722c3, 0x61687983fe617dd4, -4619},
+            {0xa0bf0465b455e921, 0x6e1f7f1642ebaac8, -4592},
+            {0xef87cb452e29d151, 0x82d8da6f93cdac5f, -4566},
+            {0xb276ce87987995d5, 0x712339ba54f12373, -4539},
+            {0x84f752d7288f298d, 0xa571e8db1718a403, -4512},
+            {0xc6228b76e0edde17, 0x14037e4fb249456c, -4486},
+            {0x939f3da4f7ac95a1, 0xf5902cd058a3459e, -4459},
+            {0xdbf9564b39593183, 0x53cb2bab20c8a14e, -4433},
+            {0xa3e4b4a65e97b76a, 0xfad2be1679765f27, -4406},
+            {0xf4385d0975edbabe, 0x1f4bf6653cd3b978, -4380},
+            {0xb5f54cf8641a39eb, 0xf6312091944a76be, -4353},
+            {0x8791c6038a5406c2, 0xf13ec1061b0a5d59, -4326},
+            {0xca03a1ec8808c808, 0x4e1c3700415ca08c, -4300},
+            {0x96832618eae7fbea, 0x2913574e1b92c75a, -4273},
+            {0xe047e2cdbacf9963, 0x93df94450179e662, -4247},
+            {0xa71a2b283c14fba6, 0x800cfab80c4e2eb1, -4220},
+            {0xf9007045a7117362, 0x0188f73caf442338, -4194},
+            {0xb9854ec6332e5955, 0xa7890845b98cde16, -4167},
+            {0x8a39458d9d62c2bc, 0xf86971b6f3f38779, -4140},
+            {0xcdf829eaaf012977, 0x36f89dc4f34187c3, -4114},
+            {0x99758b19fb78b781, 0x1387ca8b1ce5e54b, -4087},
+            {0xe4ac057c4237088f, 0x4c7284f9edda793d, -4061},
+            {0xaa5fb6fbc115010b, 0x850b0c5976b21028, -4034},
+            {0xfde07aca621db4ab, 0xe2aaafd1b2ad032f, -4008},
+            {0xbd272bb870cb662b, 0xf70aa02c1695d5c1, -3981},
+            {0x8cee12dbe4a0d94d, 0x1668cd8fad294d81, -3954},
+            {0xd20084e59f0d87f5, 0xcccfc0a963738eff, -3928},
+            {0x9c76b54415498cb9, 0xf78353292c49f96d, -3901},
+            {0xe9262a88f8e9763d, 0x1fb8f634170125f7, -3875},
+            {0xadb5a8bdaaa53051, 0x61363686961a41e5, -3848},
+            {0x816c7a5b6507a080, 0x87f3cc6eb50e8af4, -3821},
+            {0xc0db3d4e7eca8eb4, 0x6eb5b3858a7730e2, -3795},
+            {0x8fb0709caf694284, 0x0882b683a946d71e, -3768},
+            {0xd61d163a16a90d2f, 0xff2f89082e46b1ae, -3742},
+            {0x9f86ee9f12415ec4, 0x704aae82a57b7993, -3715},
+            {0xedb6c04454639d3f, 0x1ee4e4cce926ff2f, -3689},
+            {0xb11c529ec0d87268, 0xc6f075c4b81fc72d, -3662},
+            {0x83f52c420a0a1bf8, 0xd6e5a8dc8bd7642e, -3635},
+            {0xc4a1dec852f642e0, 0xfb76bdb0cdb84005, -3609},
+            {0x9280a2cc8488bcda, 0xe036eb6b5e3bec8a, -3582},
+            {0xda4e4336d9d0c24c, 0x75818e2ae06e32af, -3556},
+            {0xa2a682a5da57c0bd, 0x87a601586bd3f699, -3529},
+            {0xf25e3727b45c6992, 0x5be907baba431c52, -3503},
+            {0xb494086bbfea00c3, 0xb4e4be5b6455ef96, -3476},
+            {0x868a9188a89e1467, 0x101313e03760e378, -3449},
+            {0xc87b6d2f3f64789e, 0x7855b18ac87d35cd, -3423},
+            {0x955eeebcad65073a, 0xc0c3c7be18e982f1, -3396},
+            {0xde947326722fce77, 0x163c6c3c7e1ebb91, -3370},
+            {0xa5d5be4da760249d, 0xfbc40f7bef8efd8b, -3343},
+            {0xf71d01e03613f568, 0x52e84de3b97f1642, -3317},
+            {0xb81d1f9569068d8e, 0x24d256c540a50309, -3290},
+            {0x892ce9d7b99eab00, 0x4568eb7869ae9984, -3263},
+            {0xcc68475ee6d61547, 0x3a2dc0fad0987ebd, -3237},
+            {0x984b9b19e1f045dd, 0x402596199721b820, -3210},
+            {0xe2f00f59202af917, 0x19a5520bd7726c9f, -3184},
+            {0xa914f00d6d3ea873, 0x71226b81b4da9f94, -3157},
+            {0xfbf39559bde4d162, 0x6f9a1e6b09d69331, -3131},
+            {0xbbb7ef38bb827f2d, 0x6d4aa5b50bb5dc0d, -3104},
+            {0x8bdc7616c6bba5a9, 0x6c5f5777645c3456, -3077},
+            {0xd068ce0e5df81f31, 0xb71f0cf586321e34, -3051},
+            {0x9b46eff3160cf51c, 0xd251bd4f9f866fff, -3024},
+            {0xe761832efdc06462, 0x07cd71a4ad11c394, -2998},
+            {0xac6467e5673d0382, 0x865476315b96ddd6, -2971},
+            {0x807134651c13c651, 0x13fda689fcff66e2, -2944},
+            {0xbf64d0275747de70, 0x925624c0d7d93317, -2918},
+            {0x8e997872a9b05ac7, 0xe31578d4e269d268, -2891},
+            {0xd47d63d97a67ac32, 0x215b5faad6f6d85a, -2865},
+            {0x9e5136c0690a053c, 0x9f18944678f66cb8, -2838},
+            {0xebe93c22543540c0, 0x2e814ff88821118f, -2812},
+            {0xafc47766cb39a7b0, 0xd7be2621598b9455, -2785},
+            {0x82f4fade893ee233, 0x9af3aae885b785c9, -2758},
+            {0xc3241cf0094a8e70, 0x8e5a2e5116baf191, -2732},
+            {0x91643463eaca29a1, 0x761d8a657835936b, -2705},
+            {0xd8a66d4a505de96b, 0x5ae1b25946117390, -2679},
+            {0xa16aba6a37e20240, 0xd577ab7971db9158, -2652},
+            {0xf087a9d225901d44, 0x0ca75faa0a3f82b3, -2626},
+            {0xb33571bba36ed040, 0x0306057f606feaed, -2599},
+            {0x85855c0f774fb85e, 0x4b48b0e153cdce9a, -2572},
+            {0xc6f631e782d57096, 0xb0560c246f90e9e8, -2546},
+            {0x943ceeb53f5b6ea9, 0x339c323eb71409f8, -2519},
+            {0xdce450e2dfee1664, 0x8cc9f4e5f06e5200, -2493},
+            {0xa493c75052eb8374, 0xd521d9abbfeb2fee, -2466},
+            {0xf53d3e0ceae375c5, 0x60d47e1b1b8dec8e, -2440},
+            {0xb6b7abaecf92edcf, 0x69897dbf4a1ef53d, -2413},
+            {0x88229724c7e55658, 0xf25f797d81355203, -2386},
+            {0xcadb6d313c8736fc, 0x2ffff1289a804c5b, -2360},
+            {0x9723ed8a28baf5ac, 0x73b2baf13aa1c233, -2333},
+            {0xe1377726f2c3e173, 0x8e7258ed54128882, -2307},
+            {0xa7ccab5157ac8785, 0xd0c3ebc7bdcd296f, -2280},
+            {0xfa0a6cdb8871347c, 0xd04ee5efc60d3e49, -2254},
+            {0xba4b7bb42e17a925, 0x54d322a2add13eb6, -2227},
+            {0x8accec8801fdeeac, 0xe183a95c90cd47ef, -2200},
+            {0xced42ec885d9dbbe, 0xa855e127113c887c, -2174},
+            {0x9a197865b4730dd0, 0x1c6b313713a077e8, -2147},
+            {0xe5a04aa62b553e99, 0xf74ce198d654ca94, -2121},
+            {0xab15b5d22f85dc7a, 0xe66feaceb7836f69, -2094},
+            {0xfeefac8c78b50bc3, 0xb9af4e87b2b8504d, -2068},
+            {0xbdf139f0ee5092c6, 0x8904f03c4c1d014b, -2041},
+            {0x8d849de5850cede5, 0x35d71b0dcaccf5c6, -2014},
+            {0xd2e0d889c213fd60, 0xe00bad8dfc0d8c8e, -1988},
+            {0x9d1dd8315e4694fe, 0x79194f644b08e7c7, -1961},
+            {0xea1f3806467f9466, 0x36c30d4bce887fe2, -1935},
+            {0xae6f37c5b3ef3ea4, 0xca41c1f4689e74f8, -1908},
+            {0x81f6badf97b46aae, 0x36f5ef860d60fc42, -1881},
+            {0xc1a940440c4e8544, 0x6421568044a1203d, -1855},
+            {0x9049ee32db23d21c, 0x7132d332e3f204d5, -1828},
+            {0xd701ce3bd387bf47, 0xc654d07271e6c3a0, -1802},
+            {0xa031574414b59218, 0xb5d191c89ea338e5, -1775},
+            {0xeeb4ae0d908cf4b8, 0xa6b44da84e956fd8, -1749},
+            {0xb1d983b479007736, 0x61eb52e27ba1a893, -1722},
+            {0x848221b7dacdc3f1, 0xf7835c9260711549, -1695},
+            {0xc573ea4ef740c3c6, 0x67c7043a154a19cc, -1669},
+            {0x931d21b52ac983c5, 0x1f32b84316fbe43a, -1642},
+            {0xdb377599b6074244, 0x84c663cee6b86e7c, -1616},
+            {0xa354416960ae4744, 0x6d25505da7a82e48, -1589},
+            {0xf3611dad8ea309ed, 0xd054cd6262834da1, -1563},
+            {0xb554edc4bf0772ee, 0x2c81a8c0730a185b, -1536},
+            {0x871a49813ffc68a6, 0x1a4eb006f7ce07df, -1509},
+            {0xc951957e6330f60f, 0x5d2cf7708e13883e, -1483},
+            {0x95fe7e07c91efafa, 0x3931b850df08e738, -1456},
+            {0xdf82365c497b5453, 0xcb285ceb2fed040e, -1430},
+            {0xa686e3e8b11b0857, 0x88db9fffd5e6810f, -1403},
+            {0xf824fa0ddda26c5c, 0xf1cce649a9444799, -1377},
+            {0xb8e1cbc28bef0b68, 0xdd43439d66823071, -1350},
+            {0x89bf722840327f82, 0x16a7853ce21f945f, -1323},
+            {0xcd42a11346f34f7d, 0x0092757bf2623727, -1297},
+            {0x98ee4a22ecf3188b, 0x9028bed2939a635c, -1270},
+            {0xe3e27a444d8d98b7, 0xfd1b1b2308169b25, -1244},
+            {0xa9c98d8ccb009506, 0x680efdaf511f18c2, -1217},
+            {0xfd00b897478238d0, 0x8920b098955522b5, -1191},
+            {0xbc807527ed3e12bc, 0xc605083704f5ecf2, -1164},
+            {0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b15, -1137},
+            {0xd1476e2c07286faa, 0x1af5af660db4aee2, -1111},
+            {0x9becce62836ac577, 0x4ee367f9430aec33, -1084},
+            {0xe858ad248f5c22c9, 0xd1b3400f8f9cff69, -1058},
+            {0xad1c8eab5ee43b66, 0xda3243650005eecf, -1031},
+            {0x80fa687f881c7f8e, 0x7ce66634bc9d0b9a, -1004},
+            {0xc0314325637a1939, 0xfa911155fefb5309, -978},
+            {0x8f31cc0937ae58d2, 0xd1b2ecb8b0908811, -951},
+            {0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a65, -925},
+            {0x9efa548d26e5a6e1, 0xc47bc5014a1a6db0, -898},
+            {0xece53cec4a314ebd, 0xa4f8bf5635246428, -872},
+            {0xb080392cc4349dec, 0xbd8d794d96aacfb4, -845},
+            {0x8380dea93da4bc60, 0x4247cb9e59f71e6d, -818},
+            {0xc3f490aa77bd60fc, 0xbedbfc4411068a9d, -792},
+            {0x91ff83775423cc06, 0x7b6306a34627ddcf, -765},
+            {0xd98ddaee19068c76, 0x3badd624dd9b0957, -739},
+            {0xa21727db38cb002f, 0xb8ada00e5a506a7d, -712},
+            {0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac2, -686},
+            {0xb3f4e093db73a093, 0x59ed216765690f57, -659},
+            {0x8613fd0145877585, 0xbd06742ce95f5f37, -632},
+            {0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc1, -606},
+            {0x94db483840b717ef, 0xa8c2a44eb4571cdc, -579},
+            {0xddd0467c64bce4a0, 0xac7cb3f6d05ddbdf, -553},
+            {0xa54394fe1eedb8fe, 0xc2974eb4ee658829, -526},
+            {0xf64335bcf065d37d, 0x4d4617b5ff4a16d6, -500},
+            {0xb77ada0617e3bbcb, 0x09ce6ebb40173745, -473},
+            {0x88b402f7fd75539b, 0x11dbcb0218ebb414, -446},
+            {0xcbb41ef979346bca, 0x4f2b40a03ad2ffba, -420},
+            {0x97c560ba6b0919a5, 0xdccd879fc967d41a, -393},
+            {0xe2280b6c20dd5232, 0x25c6da63c38de1b0, -367},
+            {0xa87fea27a539e9a5, 0x3f2398d747b36224, -340},
+            {0xfb158592be068d2e, 0xeed6e2f0f0d56713, -314},
+            {0xbb127c53b17ec159, 0x5560c018580d5d52, -287},
+            {0x8b61313bbabce2c6, 0x2323ac4b3b3da015, -260},
+            {0xcfb11ead453994ba, 0x67de18eda5814af2, -234},
+            {0x9abe14cd44753b52, 0xc4926a9672793543, -207},
+            {0xe69594bec44de15b, 0x4c2ebe687989a9b4, -181},
+            {0xabcc77118461cefc, 0xfdc20d2b36ba7c3d, -154},
+            {0x8000000000000000, 0x0000000000000000, -127},
+            {0xbebc200000000000, 0x0000000000000000, -101},
+            {0x8e1bc9bf04000000, 0x0000000000000000, -74},
+            {0xd3c21bcecceda100, 0x0000000000000000, -48},
+            {0x9dc5ada82b70b59d, 0xf020000000000000, -21},
+            {0xeb194f8e1ae525fd, 0x5dcfab0800000000, 5},
+            {0xaf298d050e4395d6, 0x9670b12b7f410000, 32},
+            {0x82818f1281ed449f, 0xbff8f10e7a8921a4, 59},
+            {0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb, 85},
+            {0x90e40fbeea1d3a4a, 0xbc8955e946fe31ce, 112},
+            {0xd7e77a8f87daf7fb, 0xdc33745ec97be906, 138},
+            {0xa0dc75f1778e39d6, 0x696361ae3db1c721, 165},
+            {0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e, 191},
+            {0xb2977ee300c50fe7, 0x58edec91ec2cb658, 218},
+            {0x850fadc09923329e, 0x03e2cf6bc604ddb0, 245},
+            {0xc646d63501a1511d, 0xb281e1fd541501b9, 271},
+            {0x93ba47c980e98cdf, 0xc66f336c36b10137, 298},
+            {0xdc21a1171d42645d, 0x76707543f4fa1f74, 324},
+            {0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6, 351},
+            {0xf46518c2ef5b8cd1, 0x7eb258665fc25d69, 377},
+            {0xb616a12b7fe617aa, 0x577b986b314d6009, 404},
+            {0x87aa9aff79042286, 0x90fb44d2f05d0843, 431},
+            {0xca28a291859bbf93, 0x7d7b8f7503cfdcff, 457},
+            {0x969eb7c47859e743, 0x9f644ae5a4b1b325, 484},
+            {0xe070f78d3927556a, 0x85bbe253f47b1417, 510},
+            {0xa738c6bebb12d16c, 0xb428f8ac016561db, 537},
+            {0xf92e0c3537826145, 0xa7709a56ccdf8a83, 563},
+            {0xb9a74a0637ce2ee1, 0x6d953e2bd7173693, 590},
+            {0x8a5296ffe33cc92f, 0x82bd6b70d99aaa70, 617},
+            {0xce1de40642e3f4b9, 0x36251260ab9d668f, 643},
+            {0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29, 670},
+            {0xe4d5e82392a40515, 0x0fabaf3feaa5334a, 696},
+            {0xaa7eebfb9df9de8d, 0xddbb901b98feeab8, 723},
+            {0xfe0efb53d30dd4d7, 0xed238cd383aa0111, 749},
+            {0xbd49d14aa79dbc82, 0x4b2d8644d8a74e19, 776},
+            {0x8d07e33455637eb2, 0xdb0b487b6423e1e8, 803},
+            {0xd226fc195c6a2f8c, 0x73832eec6fff3112, 829},
+            {0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3, 856},
+            {0xe950df20247c83fd, 0x47c6b82ef32a2069, 882},
+            {0xadd57a27d29339f6, 0x79c5db9af1f9b563, 909},
+            {0x81842f29f2cce375, 0xe6a1158300d46640, 936},
+            {0xc0fe908895cf3b44, 0x505f522e53053ff2, 962},
+            {0x8fcac257558ee4e6, 0x213a4f0aa5e8a7b2, 989},
+            {0xd6444e39c3db9b09, 0x848ce34679abb01c, 1015},
+            {0x9fa42700db900ad2, 0x5ebf18b6d2779600, 1042},
+            {0xede24ae798ec8284, 0x2c53690b731c56ea, 1068},
+            {0xb13cc3832ef0c9ab, 0x8246fac210f8ffb5, 1095},
+            {0x840d57e2899d945f, 0x7dd9ca850e7586c3, 1122},
+            {0xc4c5e310aef8aa17, 0x1027fff56784f445, 1148},
+            {0x929b7871de7f22b9, 0x1c306f5d1b0b5fdf, 1175},
+            {0xda763fc8cb9ff9e5, 0x8e67937de0bbe1c7, 1201},
+            {0xa2c44d7ca68f5e67, 0xe3822554afac37a3, 1228},
+            {0xf28a9c07e9b09c58, 0xb5e54f71127ad373, 1254},
+            {0xb4b51be9c8c1aef2, 0xbbb0dc18ecaedd72, 1281},
+            {0x86a3364ea62c672c, 0xd76d70b23d7ab65b, 1308},
+            {0xc8a025fd4fc1a3e9, 0x336e11e175390249, 1334},
+            {0x957a4ae1ebf7f3d3, 0xa7ea9c8838ce9437, 1361},
+            {0xdebd3823e8cf1d1a, 0x4913caeac388219f, 1387},
+            {0xa5f41e77882d2ccc, 0xc52da445bae3f95e, 1414},
+            {0xf74a45433550f2e5, 0x0ca48c2c30e653b7, 1440},
+            {0xb83ed8dc0795a262, 0x7df40a744e446164, 1467},
+            {0x89460a226a52215b, 0x0e1beeb880cec448, 1494},
+            {0xcc8db83b7ae6acb8, 0xaf04f2e779de3b3f, 1520},
+            {0x9867806127ece4f4, 0xbf1d49cacccd5e68, 1547},
+            {0xe319a0aea60e91c6, 0xcc655c54bc5058f9, 1573},
+            {0xa933e876d39697a6, 0x6bea2e835d888494, 1600},
+            {0xfc21bb9acab8032f, 0x6a87b7f9db68dcb0, 1626},
+            {0xbbda5186df94cad6, 0x8848e3878354303a, 1653},
+            {0x8bf61451432d7bc2, 0xc80cff6ec76dde09, 1680},
+            {0xd08efa93fc267f4e, 0x45f9d042da97b0cf, 1706},
+            {0x9b63610bb9243e46, 0x655494c5c95d77f2, 1733},
+            {0xe78be4dcc84ca7f5, 0x055ffa653e97f1ab, 1759},
+            {0xac83fb896b6795fc, 0xc6ebceff061b64c6, 1786},
+            {0x8088bb2d3612eed0, 0xb404b1aac3b0b1ac, 1813},
+            {0xbf87decc3576d3d1, 0x49738b9f99b4642d, 1839},
+            {0x8eb39714297efb27, 0xbcafdba96ebcb609, 1866},
+            {0xd4a44fb4b8fa79af, 0x9d3c1b8618251f10, 1892},
+            {0x9e6e366733f85561, 0x02e008393fd60b56, 1919},
+            {0xec14723ca652c077, 0x7c1905f910e5cb29, 1945},
+            {0xafe4a94f76432468, 0x5de8a4525e3217a6, 1972},
+            {0x830cf791e54a9d1c, 0x96e4ac8ae2f0a61d, 1999},
+            {0xc347db4b6c88001f, 0xd94035b4bffd40c3, 2025},
+            {0x917ed5f0015a1188, 0xbaa52e2b9df18c0c, 2052},
+            {0xd8ce1c3a2fffaea7, 0x3a4181cdda0d6e24, 2078},
+            {0xa1884b69ade24964, 0x55e04dba4b3bd4de, 2105},
+            {0xf0b3b881b42db4c5, 0x4d302a4ac4b9e2a8, 2131},
+            {0xb35645023a0a7440, 0xe6c718689233c753, 2158},
+            {0x859dd0fd1d56a936, 0xd9795b2c6c5ade3c, 2185},
+            {0xc71aa36a1f8f01cb, 0x9dad43f230e1226f, 2211},
+            {0x945815bc19c8944c, 0x50c7d7614ea142ff, 2238},
+            {0xdd0cc6b927faa12d, 0x3d125d6abd7b2ff6, 2264},
+            {0xa4b1ec80f47c84ad, 0x44b222741eb1ebbf, 2291},
+            {0xf56a298f437028f3, 0x31a0a1f380ba36ee, 2317},
+            {0xb6d9237c1e74ad30, 0x968c105dbc9b2d9d, 2344},
+            {0x883b86a752307a07, 0xd51095d318dd6563, 2371},
+            {0xcb00955d056a80e2, 0xfa4784058c69ede3, 2397},
+            {0x973f9ca8cd00a68c, 0x6c8d3fca02ca6de7, 2424},
+            {0xe160b7c88f64436d, 0x39043548dccb1526, 2450},
+            {0xa7eb6799e8aec999, 0x1cf4a5c3bc09fa6f, 2477},
+            {0xfa3839837957ae23, 0x1243f49f2c0bed68, 2503},
+            {0xba6d9b40d7cc9ecc, 0xdf143bbe46291877, 2530},
+            {0x8ae65905d730731a, 0x3fde73159f45cf1b, 2557},
+            {0xcefa113102416fd0, 0x22229184bcf2f5c6, 2583},
+            {0x9a35b24641d05952, 0xc428bda7b3e7ac74, 2610},
+            {0xe5ca5a0b8d737f0e, 0x23114665acc60d3b, 2636},
+            {0xab350c27feb90acc, 0x3c4a575151b294dd, 2663},
+            {0xff1e5ec27be2cb7d, 0x4829f5df8a8967af, 2689},
+            {0xbe140485ba9d9d10, 0xc4ffcc51b7b7a92d, 2716},
+            {0x8d9e89d11346bda5, 0x7e289e1eabe77167, 2743},
+            {0xd30778d466259639, 0xe1bef5e7ebbfb33d, 2769},
+            {0x9d3a9f8b4ee575dd, 0xfad4bef696066547, 2796},
+            {0xea4a1a3bc59b4fb3, 0xfbd3b2a3b09b7d3b, 2822},
+            {0xae8f2b2ce3d5dbe9, 0x870a8d87239d8f35, 2849},
+            {0x820e8900eb75a6bf, 0x8d3631ab8d5dfc72, 2876},
+            {0xc1ccb93a391cb32e, 0xa8a3bca1263a081c, 2902},
+            {0x90645c0ad44c8533, 0xcdd33352984b496a, 2929},
+            {0xd72930205a0c1b2f, 0xaae8c1d6c83415a0, 2955},
+            {0xa04eaedc809b2852, 0xdb403828da8c8753, 2982},
+            {0xeee06733ce7a53e5, 0x013a107f2e73cde9, 3008},
+            {0xb1fa17404a30e5e8, 0xdd929f09c3eff5ad, 3035},
+            {0x849a672a0d2ecfd1, 0xc832a5685e79350d, 3062},
+            {0xc59815108b1f5c88, 0x553da9f686e0c463, 3088},
+            {0x93381404c2098319, 0x0ef368157e64afae, 3115},
+            {0xdb5f9ce27c044d14, 0x1fc587bda1347841, 3141},
+            {0xa3722c1341fa93de, 0x13fe73c71ddf07ef, 3168},
+            {0xf38db1f9dd3dac05, 0x78d2969539bcb6d3, 3194},
+            {0xb5762497dbf17a9e, 0x1931b583a9431d7e, 3221},
+            {0x8733089a5955b9d5, 0x9221285f3b009256, 3248},
+            {0xc976758681750c17, 0x650d3d28f18b50ce, 3274},
+            {0x9619f766f18cc11c, 0xdfb0f5bef4fbe67a, 3301},
+            {0xdfab26e6ab9971c5, 0xaeba709ca18d7956, 3327},
+            {0xa6a56485299ebc93, 0x7313665641013825, 3354},
+            {0xf8526dcaa67e0b77, 0x8686ad2b30c2d962, 3380},
+            {0xb903a90f561d25e2, 0xe30db03e0f8dd286, 3407},
+            {0x89d8ad49fe4eca49, 0xdbdf433d33267058, 3434},
+            {0xcd6839ee857cf792, 0x716cceb16a9f7c01, 3460},
+            {0x990a4d36997a9834, 0x1eac5b7d1142d87c, 3487},
+            {0xe40c380107510c5b, 0x9021ec9f1c2fd7d7, 3513},
+            {0xa9e8a70b6b2fa79b, 0x29c2788c195818da, 3540},
+            {0xfd2f102475a30594, 0x67c8cb01a187049e, 3566},
+            {0xbca2fc30cc19f090, 0x9eb5cb19647508c5, 3593},
+            {0x8c8b9671cad73d1b, 0x3e118e14b897cf04, 3620},
+            {0xd16dc378c5d5dd8b, 0xff6c0833d3f5a467, 3646},
+            {0x9c095ddce7f51c37, 0x56134159fe6672e8, 3673},
+            {0xe8833c181c3bbfe0, 0xdc18d6ce622438a3, 3699},
+            {0xad3c440a6e2c17d1, 0x44782d2e0740c0e7, 3726},
+            {0x811208693deeefd4, 0x5179a2585cd523a1, 3753},
+            {0xc054773d149bf26b, 0x24bd4c00042ad125, 3779},
+            {0x8f4c0691750e8305, 0x0a40de037c9ad730, 3806},
+            {0xd587753c9109d50f, 0x8b609b637995b9ff, 3832},
+            {0x9f17732dfac7617b, 0x3b7dffb204b6d932, 3859},
+            {0xed10a12f4893c83b, 0xf1ad377b4c62d823, 3885},
+            {0xb0a08d798abce436, 0x026b8897e82cde8d, 3912},
+            {0x8398f4fc2be9456f, 0x49fc56a67ef2cb26, 3939},
+            {0xc418753460cdcca9, 0x7ea30dbd7ea479e3, 3965},
+            {0x921a417600f66121, 0xd20b33c51cdec315, 3992},
+            {0xd9b5b441df1ca24a, 0x75bd95cf6d4e57f9, 4018},
+            {0xa234d86ffa7f555e, 0x065a7b21aa2e587d, 4045},
+            {0xf1b4d7715268ec5c, 0xc8df254170d729f8, 4071},
+            {0xb415d6eaed508ec7, 0x8ec4baa1d276bd43, 4098},
+            {0x862c8c0eeb856ecb, 0x085bccd5c05ee9fa, 4125},
+            {0xc7ef52defe87b751, 0x764f4cf916b4dece, 4151},
+            {0x94f68c404707858a, 0x0c8bec274f660d07, 4178},
+            {0xddf8e78b0ae78f06, 0xeec4a3302ea1ed14, 4204},
+            {0xa561da6259253f91, 0x202e275e2e6472b3, 4231},
+            {0xf670513b335ecf5a, 0x18d00e452908c963, 4257},
+            {0xb79c7593a1c17df0, 0xfe7fe67bd1074d0d, 4284},
+            {0x88cd0d1d792ad9c9, 0x899bf2cd24e066ad, 4311},
+            {0xcbd96ed6466cf081, 0xbeb7fbdc1cbe8b37, 4337},
+            {0x97e12d6b9b7b5b4e, 0x88e4d3e152760ad9, 4364},
+            {0xe251781ebc325f95, 0x85605cd2de50aa18, 4390},
+            {0xa89ec74535436f75, 0x76be2854b7757d45, 4417},
+            {0xfb4383271a87a1ce, 0xeca608d886d5085f, 4443},
+            {0xbb34c053c6cd0903, 0x5bd2e213f4303184, 4470},
+            {0x8b7ab8e2031ca41c, 0xbdbe5e23322596aa, 4497},
+            {0xcfd7298db6cb9672, 0xdce472c619aa3f63, 4523},
+            {0x9ada6cd496ef0e05, 0x2f1a208fdedff747, 4550},
+            {0xe6bfd112037dada8, 0x0d09427bea47c3b9, 4576},
+            {0xabebeee0e1f4179d, 0xf6cb73c5f330cd40, 4603},
+            {0x8017720bd2b53507, 0x181ffc2f5e558e92, 4630},
+            {0xbedf0fbeeaa56989, 0xb77caf58b4a564e0, 4656},
+            {0x8e35d15b2452f322, 0x648280a4312280e9, 4683},
+            {0xd3e8e55c3c1f43d0, 0xe47defc14a406e50, 4709},
+            {0x9de293c00106e2ce, 0xbf7760fd45068278, 4736},
+            {0xeb445f92a877bb09, 0xbc921b2c3eb25c7c, 4762},
+            {0xaf49a28d94aee9cd, 0x8c7c23090e6bf376, 4789},
+            {0x829976a1a8a4b490, 0x1e70feb9f7bbd7c6, 4816},
+            {0xc29bbe24916c9818, 0x4e0077ae6c8d2e1e, 4842},
+            {0x90fe99d23e8df6cf, 0x4ec0aaeb679e4d7a, 4869},
+            {0xd80f0685a81b2a81, 0xb7157c60a24a056a, 4895},
+            {0xa0f9ece1ddbc5282, 0xe2749cf9bef632aa, 4922},
+            {0xefdf92f1ac19ae82, 0x8d026ce66d845c8c, 4948},
+            {0xb2b8353b3993a7e4, 0x4257ac3b4c1d7794, 4975},
+            {0x85280d2012e1463d, 0x29da528173912de8, 5002},
+            {0xc66b2798e66a23da, 0x4584d597ea4d9a44, 5028},
+            {0x93d556e1f43f195b, 0x985eecc43628a6c5, 5055},
+            {0xdc49f3445824e360, 0xfb0b98f6bbc4f0cc, 5081},
+            {0xa420c4649e04a6dd, 0x91f7176ce7ace6d1, 5108},
+            {0xf491dcadff702607, 0x23d08e2dd5b4267c, 5134},
+            {0xb637fb796ef29283, 0x3e93fb28800a5f93, 5161},
+            {0x87c37487ccf4b0bf, 0x532430e7002aca8e, 5188},
+            {0xca4da9fd98d230fc, 0xc49baa87c3c18390, 5214},
+            {0x96ba4e7cc2e7edd1, 0xd9ab8375744e5a39, 5241},
+            {0xe09a13d30c2dba62, 0xc6c6c1764e047e15, 5267},
+            {0xa75767f07481436f, 0xe75dd664b8f76aa1, 5294},
+            {0xf95bb07f70171b15, 0x78a715e7dc181be9, 5320},
+            {0xb9c94b7fa8d76514, 0xb6b34c0b0e5c81ef, 5347},
+            {0x8a6bed155a7fd04e, 0x8771d4f27648962a, 5374},
+            {0xce43a50ae4f7fb8e, 0x7877892520ee1715, 5400},
+            {0x99adc7f3be918f6f, 0x797afea136d98819, 5427},
+            {0xe4ffd276eedce658, 0x87e8dcfc09dbc33b, 5453},
+            {0xaa9e26b2ceee3b0a, 0x7aadb4027407d984, 5480},
+            {0xfe3d8461cb764145, 0xd440a4ff74d6af6a, 5506},
+            {0xbd6c7d357d5f68b8, 0x8af89476d8f11274, 5533},
+            {0x8d21b84735fb9175, 0xcbc19e1c4ed917da, 5560},
+            {0xd24d7a58caca82e7, 0x63d41e02a62521f9, 5586},
+            {0x9cb00bfd6f025339, 0x2e61aa868501e740, 5613},
+            {0xe97b9b89d001dab3, 0xb1a3642a8da3cf50, 5639},
+            {0xadf55165f5075bae, 0x35242e8990e4e9de, 5666},
+            {0x819be8501ce82613, 0x8ad5a7c0cc617fcb, 5693},
+            {0xc121ea3b1aa714b6, 0xf84df185fc7d1bfd, 5719},
+            {0x8fe518e41e76f767, 0xe53f11888dfb0636, 5746},
+            {0xd66b8d68727e5d97, 0x56bc4bf837b34968, 5772},
+            {0x9fc164bccf5aec92, 0xd9365d818d1eff1c, 5799},
+            {0xee0ddd84924ab88c, 0x2d4070f33b21ab7c, 5825},
+            {0xb15d3a58cd9f7620, 0xe79894cf86a0d164, 5852},
+            {0x842587f0691e747b, 0x1ad16f7260ec2a56, 5879},
+            {0xc4e9edf1e71fb3e9, 0x6dbd0bbdd3b981f1, 5905},
+            {0x92b6530184ed7fb3, 0x555c13432402e523, 5932},
+            {0xda9e43adc04c279d, 0x2206e12af8e1f962, 5958},
+            {0xa2e21dc870c7755d, 0x3b99bc6c1c6bdc26, 5985},
+            {0xf2b70909cd3fd35c, 0xa2bf0c63a814e04f, 6011},
+            {0xb4d63576caa95365, 0xf33ce3d6f17b62d2, 6038},
+            {0x86bbdf9834555994, 0x13d29038758dc824, 6065},
+            {0xc8c4e5854d219b68, 0xb54eb04c45793ab6, 6091},
+            {0x9595ac0a19d43faa, 0x0ae2a34be99c874a, 6118},
+            {0xdee60499182f84b2, 0xf9d2e9fd2f16711f, 6144},
+            {0xa6128431c0f42a68, 0x39705fc81c20e253, 6171},
+            {0xf77790f0a48a45ce, 0x08f13995cf9c2748, 6197},
+            {0xb860984ffcf589eb, 0x76ab5b01a14d15c8, 6224},
+            {0x895f2f074b86004c, 0xbc3bc2377649def0, 6251},
+            {0xccb32ff3b293a823, 0xd8305b1e859940fe, 6277},
+            {0x98836ac47b7f318c, 0x89cb22299cf5ab7b, 6304},
+            {0xe34339a152974f3d, 0x2f570b82baa59a9c, 6330},
+            {0xa952e68c74f91e40, 0x83f904625bf851b2, 6357},
+            {0xfc4fea4fd590b40a, 0x7a37993eb21444fb, 6383},
+            {0xbbfcba21506c3696, 0x14e853d8055da857, 6410},
+            {0x8c0fb73d016b8a09, 0x008e8b74f11a7464, 6437},
+            {0xd0b52e179d84f732, 0xfc8ea8820c829fe6, 6463},
+            {0x9b7fd75a060350cd, 0xffc9b96619da642b, 6490},
+            {0xe7b64e4de2fc4251, 0x4a729f6e4aafabe9, 6516},
+            {0xaca394f61973a6d8, 0x913de7cf445b03ef, 6543},
+            {0x80a046447e3d49f1, 0xb7b1ada9cdeba84e, 6570},
+            {0xbfaaf3dcf18d8356, 0xba2df8ab8a7ab36d, 6596},
+            {0x8ecdba7e70040998, 0x8249af97add63496, 6623},
+            {0xd4cb42b1069a202d, 0x7bcadd7178b73422, 6649},
+            {0x9e8b3b5dc53d5de4, 0xa74d28ce329ace52, 6676},
+            {0xec3fb04131583ad0, 0xa7a56bb94c2baa48, 6702},
+            {0xb004e11dc887de9d, 0x1501f863501381f8, 6729},
+            {0x8324f8aa08d7d411, 0x0cc6866c5d69b2cc, 6756},
+            {0xc36ba032dd07ddfe, 0xbd05b64feb6d3000, 6782},
+            {0x91997c5cd96c842b, 0x131ce521ea35eb3d, 6809},
+            {0xd8f5d26eda33a1ed, 0x30adbb561ac082ed, 6835},
+            {0xa1a5e1d389a86b5f, 0x688e56b5328149e4, 6862},
+            {0xf0dfcf43277d1129, 0x6e2cb3e7e6c76434, 6888},
+            {0xb3771e4c06883784, 0xfc57441fd21273a5, 6915},
+            {0x85b64a659077660e, 0x7fe2b4308dcbf1a4, 6942},
+            {0xc73f1b999a36cef9, 0x44a3f86966d721ad, 6968},
+            {0x947341bc28b52123, 0xd9df435d26c85dd6, 6995},
+            {0xdd3543f8a937b167, 0x2c585e610739ab45, 7021},
+            {0xa4d0173720b2afb7, 0xd0db0c7c5e6a3c5e, 7048},
+            {0xf5971d4bf34f0b73, 0x9beddc79b5ef753f, 7074},
+            {0xb6faa16ac604d6f6, 0x180f7fcdf9f88b9d, 7101},
+            {0x88547abb1d8e5bd9, 0x1d73ef3eaac3c964, 7128},
+            {0xcb25c457216180d0, 0xc591a0c565551931, 7154},
+            {0x975b50d9934dc561, 0xbc0d44f6c6443fdc, 7181},
+            {0xe189fff88a6e300a, 0x6c0854dee9fe3499, 7207},
+            {0xa80a2983b14281e0, 0xc9d6d29ccffa5ef8, 7234},
+            {0xfa660e8efeebfec9, 0x0e3b869bcfb050b2, 7260},
+            {0xba8fc10d94083c45, 0xd40fc365ef64db56, 7287},
+            {0x8affca2bd1f88549, 0x1e34291b1ef566c7, 7314},
+            {0xcf1ffa89ee943f5a, 0x6d8c112dac1084bc, 7340},
+            {0x9a51f1525bae79b6, 0x2ba1b54e05645427, 7367},
+            {0xe5f471252d623bd8, 0xcac1a98a87ec599f, 7393},
+            {0xab54683b3d20e23b, 0x212bbb6587ce8d13, 7420},
+            {0xff4d19861fcd6764, 0x44a46ab0e18f72bb, 7446},
+            {0xbe36d579ed4a918e, 0x0580f8822ea438b1, 7473},
+            {0x8db87a7c1e56d873, 0x9e9383d73d486882, 7500},
+            {0xd32e203241f4806f, 0x3f50c802040f4ccc, 7526},
+            {0x9d576c2ab5e22f1f, 0x72be5bae797e96be, 7553},
+            {0xea75044c1fc18fa0, 0x704af45d3b85f80f, 7579},
+            {0xaeaf246e48027eb6, 0xbf1e26720530cbee, 7606},
+            {0x82265b7e7efc84e0, 0xffe39290a06447d6, 7633},
+            {0xc1f038afbd28f7e0, 0x4785e3c6d7249605, 7659},
+            {0x907eceba168949b3, 0x9cc5ee51962c011a, 7686},
+            {0xd750993b8e7368ad, 0x2ef0f7a89e5247d0, 7712},
+            {0xa06c0bd4ce9db63f, 0xd51af6a3244a6983, 7739},
+            {0xef0c285c4636c5d1, 0xdba4fafb27248afc, 7765},
+            {0xb21ab0c3a4ebbfd1, 0xdfdbfae356dd42e2, 7792},
+            {0x84b2b10e5a2c8a1c, 0x1a3fe5bc78c86cfc, 7819},
+            {0xc5bc4672073224f7, 0xb2c46d6d298a0659, 7845},
+            {0x93530b43e5e2c129, 0x413407cfeeac9744, 7872},
+            {0xdb87cb8617c7353d, 0xa1ab505121a2b9b2, 7898},
+            {0xa3901c37f59012c7, 0xbde793a09c959d87, 7925},
+            {0xf3ba4e7089c084e0, 0x17f49abd213c38b9, 7951},
+            {0xb59761806ab01d37, 0xf6f5257894e6be7a, 7978},
+            {0x874bcc3bd5ad1c5b, 0x020a4cb5a7bfad70, 8005},
+            {0xc99b5c4fbc1dc1c4, 0x03c90980e2fc50e8, 8031},
+            {0x963575ce63b6332d, 0x7efa7d29c44e11b7, 8058},
+            {0xdfd41ef0c0988080, 0x4019b1707406a60a, 8084},
+            {0xa6c3eab7eb9cb770, 0x9dd22c92fae0329e, 8111},
+            {0xf87fe9daba8ca95f, 0xc587ee502f6a0325, 8137},
+            {0xb9258c901050bc53, 0x0c1beb6383dd861d, 8164},
+            {0x89f1ed0ad779e91a, 0x0783feb8365fb0b4, 8191},
+            {0xcd8dd9acbb0826ef, 0x7ba979d88ef3f46e, 8217},
+            {0x9926556bc8defe43, 0x5a848859645d1c70, 8244},
+            {0xe435fd6309d4fb29, 0x2cda83ae165bf80f, 8270},
+            {0xaa07c63c55b3ac0b, 0xa0ec43cf38e67071, 8297},
+            {0xfd5d702ea963a8b2, 0xdef5f7e641c56f96, 8323},
+            {0xbcc5898cb2023191, 0x19eca67db0e59e08, 8350},
+            {0x8ca554c020a1f0a6, 0x5dfed09922680a07, 8377},
+            {0xd1941fcaffd05738, 0xe409e3656423404b, 8403},
+            {0x9c25f29286e9ddb6, 0x51edea897b34601f, 8430},
+            {0xe8add2d7441dee52, 0xbcd3121007711268, 8456},
+            {0xad5bff3854ff2560, 0x2ab1aa038b8d63a1, 8483},
+            {0x8129aca6bc5ad3bc, 0xb6fb3bfdb16ddd38, 8510},
+            {0xc077b1c77fa526c9, 0xd1b8dbcb7efb1a18, 8536},
+            {0x8f6645e795774006, 0xeab671198d290da4, 8563},
+            {0xd5ae91d3ff7a6f8e, 0x1e914685a756a7d6, 8589},
+            {0x9f3497244186fca4, 0xb50008d92529e91f, 8616},
+            {0xed3c0d64f44dada9, 0x4dbf126f544f14e3, 8642},
+            {0xb0c0e7b24521ae78, 0xe5be11b80ca2861e, 8669},
+            {0x83b10fb893300cde, 0x111ae5735ec0e879, 8696},
+            {0xc43c60515581a678, 0x8ac4905efb765c19, 8722},
+            {0x9235045aa53b2f73, 0xec52dcd9166e62b5, 8749},
+            {0xd9dd94e2337d32ac, 0x90eb149b535b1241, 8775},
+            {0xa2528e74eaf101fc, 0xf09e780bcc8238d9, 8802},
+            {0xf1e11d4b6c140baa, 0xa12bdf1972e89ec7, 8828},
+            {0xb436d34ba143ace3, 0xb6623ff235dc3709, 8855},
+            {0x86451f9c27a41c2c, 0x6e33526901d7454d, 8882},
+            {0xc813f2038018dcc4, 0x5be12541bd907f82, 8908},
+            {0x9511d546d1e4f61e, 0xf7fd1e7a4ba0ac72, 8935},
+            {0xde21900ad4e5da18, 0xb31fb301938026de, 8961},
+            {0xa580255203f84b47, 0x3a5828869701a166, 8988},
+            {0xf69d74fc97aee56a, 0x5e0a5c3957f5dbb8, 9014},
+            {0xb7be174910b2c5ab, 0x48960bcf94ec3c9f, 9041},
+            {0x88e61bd916f61414, 0xa25e14077e72a518, 9068},
+            {0xcbfec588abe544f9, 0xa45748800fb5c50f, 9094},
+            {0x97fcff3458a37b0c, 0x97ecac7332c473b4, 9121},
+            {0xe27aec67c841f0ec, 0x4ac5999373aaf8fb, 9147},
+            {0xa8bdaa0a0064fa44, 0x8b231a70eb5444ce, 9174},
+            {0xfb71892801c8f7e6, 0x91c5999739c6f4bc, 9200},
+            {0xbb570a9a9bd977cc, 0x4c808753bb22fef8, 9227},
+            {0x8b9445356a892e18, 0xc9c91c63974bde54, 9254},
+            {0xcffd3b6601e5748a, 0xcb7517f7cdf3bb46, 9280},
+            {0x9af6ca0cfbbe713d, 0x477fab3627d51dba, 9307},
+            {0xe6ea1521bb43aebc, 0xe471d787c5786319, 9333},
+            {0xac0b6c73d065f8cc, 0xfa1bde1f473556a5, 9360},
+            {0x802ee86307473397, 0x9741fa95d195ca60, 9387},
+            {0xbf0205e40a5922fa, 0x9811feaeedcba0ce, 9413},
+            {0x8e4fddbbd3e242b6, 0xd1445b3f1cc9a09c, 9440},
+            {0xd40fb60471d20451, 0xebd28828ca3d59be, 9466},
+            {0x9dff7f22ee7e03aa, 0x39b9ad24951326f1, 9493},
+            {0xeb6f777a751a1225, 0x909ef427064c8733, 9519},
+            {0xaf69bdf68fc6a740, 0x7730e00421da4d55, 9546},
+            {0x82b16291b785d7fd, 0x80b5dd0db02965f1, 9573},
+            {0xc2bf63856b14a712, 0xfd625f6a74db9c2a, 9599},
+            {0x911928c207e4a48d, 0x5ee376bb60d61dc9, 9626},
+            {0xd83699ba2ae37e0c, 0xb1a05a0d64a2e6e8, 9652},
+            {0xa1176937e3c39bfa, 0x6ce90acc1dc87b96, 9679},
+            {0xf00b82d75a7adbc5, 0xb8787d891ab45d5b, 9705},
+            {0xb2d8f1915ba88ca5, 0x7f959cb702329d14, 9732},
+            {0x854070f666f8939f, 0x2fcf6c219d9e0e07, 9759},
+            {0xc68f7fa3c6fdd1f7, 0x41ade91c925e845e, 9785},
+            {0x93f06aef39eafd1b, 0x6e9236f022c135f3, 9812},
+            {0xdc724cd44411af53, 0x37b24bf1b205e08c, 9838},
+            {0xa43ed4844001a59e, 0xba5da243711d4f3a, 9865},
+            {0xf4bea8cc26618443, 0x472c64f9d78680ed, 9891},
+            {0xb6595be34f821493, 0x40c3a071220f5568, 9918},
+            {0x87dc529d5b6d58bc, 0xa8c728d63e6a88e8, 9945},
+            {0xca72b831ff7bef2d, 0xb5ceaf53c9875f4b, 9971},
+            {0x96d5ea42b75bda77, 0x1066a0a2c704f155, 9998},
+            {0xe0c337a094ba5508, 0x91d6314736a8573e, 10024},
+            {0xa7760ebe6f43968a, 0x19292419d105fb35, 10051},
+            {0xf9895d25d88b5a8a, 0xfdd08c4da13655ed, 10077},
+            {0xb9eb5333aa272e9b, 0x11c48d02b8326bd4, 10104},
+            {0x8a8547cedca07ea2, 0x36e44f3824550815, 10131},
+            {0xce696cf9d945feda, 0xe76412a4c4319df8, 10157},
+            {0x99c9ee1aa45cbdb6, 0x605990407cf18034, 10184},
+            {0xe529c477bea1bae8, 0x8a500dc1fc3e1c3e, 10210},
+            {0xaabd67225ffaff52, 0x10ca0e4a1563961b, 10237},
+            {0xfe6c15f5dabe23a3, 0x91491a2d7821c26d, 10263},
+            {0xbd8f2f7a1ba47d6d, 0x566765461bd2f61c, 10290},
+            {0x8d3b9215641fa557, 0xd219dbe554cbc510, 10317},
+            {0xd273ffa5348f60f1, 0x1e30ece9d9ac5900, 10343},
+            {0x9cccbf3ada49a9d0, 0x11989f89a8e6ffd5, 10370},
+            {0xe9a65fc76a44aad4, 0xae2c6960d0c96141, 10396},
+            {0xae152e792349ee7f, 0xe2cf7498cb3ae42b, 10423},
+            {0x81b3a5ceaef5edb7, 0x4e10853cf59e0dff, 10450},
+            {0xc1454a673cb9b1ce, 0xb889018e4f6e9a52, 10476},
+            {0x8fff7443ec2f51ed, 0x36ff0ad5e3a835b0, 10503},
+            {0xd692d3c7736a1e28, 0x4686a86d2ac987aa, 10529},
+            {0x9fdea7d3e89a72bd, 0x4db0c4b58afaa409, 10556},
+            {0xee39781cb677df50, 0x220bd30a961d8e5d, 10582},
+            {0xb17db720b3868e94, 0x7407cb9251918022, 10609},
+            {0x843dbc6c7825cb13, 0xb4f58d5111702e25, 10636},
+            {0xc50dff6d30c3aefc, 0xf85333a94848659f, 10662},
+            {0x92d1327c5e4eb1ac, 0xb7f3bc7bfa6bf9a0, 10689},
+            {0xdac64ee70f466ae5, 0x032727c1ccef13bb, 10715},
+            {0xa2fff38a38e25cf5, 0x45e200a7ed6429d5, 10742},
+            {0xf2e37e2edc561cad, 0x33376e62bb2f548f, 10768},
+            {0xb4f75513e1b79410, 0x5eca6709453aeeea, 10795},
+            {0x86d48d6626c27eeb, 0xd4e1e0f5d911bd40, 10822},
+            {0xc8e9abc872eb2bc1, 0x1a1aeae7cf8a9d3e, 10848},
+            {0x95b1123621f7fd8a, 0xd8a7495feba24471, 10875},
+            {0xdf0ed8875e7b8914, 0x7ce93cc7f8feeed5, 10901},
+            {0xa630ef7d5699fe45, 0x50e3660235410f99, 10928},
+            {0xf7a4e4ea08831d42, 0xd971ada1f3cb5806, 10954},
+            {0xb8825df26accd111, 0x7e226987eb943323, 10981},
+            {0x897858873508beee, 0x1e985b5cadd9fc3c, 11008},
+            {0xccd8ae88cf70ad84, 0x12e29f09d906160a, 11034},
+            {0x989f5a44cc3f1175, 0x88b292d26e2f1ff4, 11061},
+            {0xe36cda328acacd9b, 0xdfe73a64a5546431, 11087},
+            {0xa971ea4f5b66c2e2, 0x085987227beaa101, 11114},
+            {0xfc7e217a6ace9f0f, 0x7119aa2c0c5ee694, 11140},
+            {0xbc1f2909355b1724, 0x192a0948decd065f, 11167},
+            {0x8c295edadd7df0bd, 0x2c1430e82808e525, 11194},
+            {0xd0db689a89f2f9b1, 0xdf7601457ca20b36, 11220},
+            {0x9b9c52def0f2f4ff, 0xc1afeb8941b07ae6, 11247},
+            {0xe7e0bf83b9d244c0, 0x38658c6da9fcc20e, 11273},
+            {0xacc3342c8096fcab, 0x6f9ccfd9364022e5, 11300},
+            {0x80b7d5abbea40e7b, 0xaa51c75f73c297c7, 11327},
+            {0xbfce0f5ab8a6761d, 0xda1276a2f5debc0c, 11353},
+            {0x8ee7e2b25d967cfd, 0xb48994de60fc3ddf, 11380},
+            {0xd4f23ccfb1916df5, 0xcbdcd02f23cc7690, 11406},
+            {0x9ea845a515ea4c9b, 0x5b8e52277935eea0, 11433},
+            {0xec6af63168693f51, 0xb33c91ded66ff3b9, 11459},
+            {0xb0251ed2d68cf756, 0x4af0cb2615086be8, 11486},
+            {0x833cfe27c1ec89e9, 0x4de888f98cf874e7, 11513},
+            {0xc38f6ba78dc9e09c, 0x00c9ec55be063db0, 11539},
+            {0x91b427ab57bce6ad, 0xf739f1ca6f8ae61f, 11566},
+            {0xd91d8fe9a3d019cc, 0x44289dd21b589d7b, 11592},
+            {0xa1c37da8c925f472, 0x8fd1bb7aea521d60, 11619},
+            {0xf10bee17f9e5f8e2, 0x92db324a3f38c6ca, 11645},
+            {0xb397fd9a22d732d7, 0xae7edaa76fbbd923, 11672},
+            {0x85cec849a2c09220, 0x50414140b3386713, 11699},
+            {0xc7639a772bcf4c6e, 0xbb1ed0c4315f20a5, 11725},
+            {0x948e72b65556ec70, 0x39c020f6c6d16243, 11752},
+            {0xdd5dc8a2bf27f3f7, 0x95aa118ec1d08318, 11778},
+            {0xa4ee4773da78604d, 0xe96514a21ae0eea6, 11805},
+            {0xf5c419447c50865f, 0x30f451703325e355, 11831},
+            {0xb71c257be5b79e67, 0x65092dfb9e89b4f1, 11858},
+            {0x886d7361002a7720, 0x04b7ef7faa32153d, 11885},
+            {0xcb4afa20cf8f873d, 0x1bcff6d740043ba2, 11911},
+            {0x97770a1d69690db8, 0x9c6c696706710f5e, 11938},
+            {0xe1b34fb846321d04, 0x72c4d2cad73b0a7b, 11964},
+            {0xa828f10fb963c71c, 0xe012eb55f30d3c0a, 11991},
+            {0xfa93ebffa28c5474, 0x40cc6921f5da1d53, 12017},
+            {0xbab1ed1b87df7a0d, 0xd805d43df68cacac, 12044},
+            {0x8b193ffaccb315af, 0xd7c0b2ce95053648, 12071},
+            {0xcf45ead490352e65, 0xa3f2e2617152417c, 12097},
+            {0x9a6e358af47bf184, 0x281f5ee0edf6732d, 12124},
+            {0xe61e8ff47461cda9, 0xe20a88f1134f906d, 12150},
+            {0xab73ca0cf7e49d03, 0x583b0da0ce7d5e09, 12177},
+            {0xff7bdcd8f586aed0, 0xbb2215057a199357, 12203},
+            {0xbe59acceb1296358, 0x2206d005c3455566, 12230},
+            {0x8dd26fe784e0a845, 0x8a650fa5e52994b5, 12257},
+            {0xd354cea4a14284f6, 0x89a2aa427fbbc719, 12283},
+            {0x9d743e108a6a5fb0, 0xefd29f06b8eb7ba2, 12310},
+            {0xea9ff638c54554e1, 0xc7c91d5c341ed39e, 12336},
+            {0xaecf238af2e16c92, 0x92b234752210ae36, 12363},
+            {0x823e32591ebf0a7c, 0xb2165023bbdc09ce, 12390},
+            {0xc213bea5c91f03d8, 0x421ddc40535f78b4, 12416},
+            {0x9099464184d970c5, 0x345dbfa938a6201e, 12443},
+            {0xd778098ec2fe43f8, 0xb7915f48208c19d5, 12469},
+            {0xa0896e2dfac1c18c, 0x4b63ca6bad08e621, 12496},
+            {0xef37f1886f4b6690, 0xf659ede2159a45ed, 12522},
+            {0xb23b503fa0fcbf68, 0x561dc763bbcc9fe4, 12549},
+            {0x84caff65923dc3cb, 0x9876629e2b8c406a, 12576},
+            {0xc5e07e74a21bdde9, 0x3a4a8e61399bb080, 12602},
+            {0x936e07737dc64f6d, 0x8c474bb609f40288, 12629},
+            {0xdbb00185e22ff89c, 0xd8fb402b3d1254a2, 12655},
+            {0xa3ae11d87c627204, 0xfb4d6d429f19dbe9, 12682},
+            {0xf3e6f313130ef0ef, 0x78d946bab954b82f, 12708},
+            {0xb5b8a47f8889782c, 0x89abf129af845215, 12735},
+            {0x87649466898e3d36, 0x7de8487789065008, 12762},
+            {0xc9c049db4fe2ce2a, 0x5a3b5835f1148253, 12788},
+            {0x9650f93f0b94698f, 0x2fd79a543b9101ec, 12815},
+            {0xdffd1e7be8191190, 0xafb619b59ab7caba, 12841},
+            {0xa6e27681fd108a75, 0x6adc46c66d68bac6, 12868},
+            {0xf8ad6e3fa030bd15, 0xc9b1474d8f89c26a, 12894},
+            {0xb9477645dd65c427, 0x1f546a5216675967, 12921},
+            {0x8a0b316ba468d9fd, 0xce808cd18e336b0d, 12948},
+            {0xcdb3804f2a8006af, 0x21cd9176061191f9, 12974},
+            {0x994262c36bb8204a, 0xe48949261d5c4000, 13001},
+            {0xe45fca6bbb9c614c, 0xa14e2b5a55d995d5, 13027},
+            {0xaa26eb2095a94e81, 0xe0280dbea779d3ba, 13054},
+            {0xfd8bd8b770cb469e, 0x6b1d2745340e7b15, 13080},
+            {0xbce81d3cc784a1ca, 0xd8aa19f1d85da07e, 13107},
+            {0x8cbf17c5985e8e6b, 0xf1feb741cf6e9ceb, 13134},
+            {0xd1ba8323fe558c61, 0x0d5c82a286614f3f, 13160},
+            {0x9c428c845596c4cd, 0xd0bc9a901f6b3913, 13187},
+            {0xe8d87163748a96f8, 0x4155fea018f5560f, 13213},
+            {0xad7bc03623b4e064, 0x71acd64c8fec6d29, 13240},
+            {0x81415538ce493bd5, 0xf22e502fcdd4bca2, 13267},
+            {0xc09af2c5d2f1e3f3, 0xc4adef984fca0beb, 13293},
+            {0x8f808a0c7a2f2b30, 0x8f7c0024bd059732, 13320},
+            {0xd5d5b5956a3497ef, 0x4f1af235be931be6, 13346},
+            {0x9f51c070f53fb4a9, 0xc3720171212fda90, 13373},
+            {0xed67818ec20f030d, 0x449eba728bc80f02, 13399},
+            {0xb0e147d8090f7f8b, 0xf70ddb85c72b7388, 13426},
+            {0x83c92edf425b292d, 0x7c1735fc3b813c8d, 13453},
+            {0xc46052028a20979a, 0xc94c153f804a4a92, 13479},
+            {0x924fcc2626a1f1b8, 0x4a05a4ce3e8149f1, 13506},
+            {0xda057cd06c6aaa51, 0x10fb2b6d9ce74746, 13532},
+            {0xa27049eb0920d64a, 0x936d04cea460945b, 13559},
+            {0xf20d6b41853ce899, 0xa5f1001d0cb4732a, 13585},
+            {0xb457d5b712693e04, 0x7711efcfc4c6e394, 13612},
+            {0x865db7a9ccd2839e, 0x0367500a8e9a1790, 13639},
+            {0xc83897dd3b57c3c4, 0x7e09db670f30d0f3, 13665},
+            {0x952d234ccb7e5f2a, 0x92506fd4d86244d4, 13692},
+            {0xde4a3ffd1fada9be, 0x8f80f0b84dc4e498, 13718},
+            {0xa59e75ce2365cb79, 0xcbaae749af2847f9, 13745},
+            {0xf6caa102a0c2a065, 0x1813453fce0b79ca, 13771},
+            {0xb7dfbf27855ed611, 0x26289e8e9e6fce93, 13798},
+            {0x88ff2f2bade74531, 0xc9ac50475e25293a, 13825},
+            {0xcc242311ea15a1dd, 0x59c86eaaeca34751, 13851},
+            {0x9818d61591463347, 0xdb6c5c8d2efc546b, 13878},
+            {0xe2a46848a8d6f78b, 0x88111764983edba9, 13904},
+            {0xa8dc92770fb49eb2, 0x38660cebf9cb0839, 13931},
+            {0xfb9f9796feccf0c6, 0xc926df2ac49b40db, 13957},
+            {0xbb795b2956f2190d, 0xf95f6b527d38f4ba, 13984},
+            {0x8badd636cc48b341, 0x0879b2e5f6ee8b1d, 14011},
+            {0xd02354376d45a7ed, 0xfce95a6a89064297, 14037},
+            {0x9b132c776654df72, 0xa978ac16a33c9725, 14064},
+            {0xe71460ef566221eb, 0x9bd4b30c86935a29, 14090},
+            {0xac2aefcb5dfe300a, 0x0aebc0915f75c1f3, 14117},
+            {0x8046630667151a12, 0x817c3f6ac7adac5b, 14144},
+            {0xbf2502708b2c5377, 0x09e73cfeb515c4d8, 14170},
+            {0x8e69eee1f23f2be5, 0x2f33c652bd12fab8, 14197},
+            {0xd4368dc8bb2a0e80, 0x75a77a3b0bc28f4e, 14223},
+            {0x9e1c6fd1ec0bc10b, 0x3f78c26a855e6ab5, 14250},
+            {0xeb9a9746f2a89ed3, 0x2aff49d1db06aa69, 14276},
+            {0xaf89df41131c380a, 0x70d771a3dfe606c0, 14303},
+            {0x82c952e37be11cb4, 0x6e6c12aa02b9a1ec, 14330},
+            {0xc2e30f6dbeb8f836, 0x4417b60aca6a0daf, 14356},
+            {0x9133bc8f2a130fe5, 0xad6a6308a8e8b557, 14383},
+            {0xd85e342e63dde21d, 0x0aba0a9ce833ad32, 14409},
+            {0xa134eaf486b5d13f, 0x578d95d780e47d85, 14436},
+            {0xf0377ac949d8df52, 0xcf4e98435d4e5a23, 14462},
+            {0xb2f9b3e67ffa5a3e, 0x9296eca3a3c1181a, 14489},
+            {0x8558d94466be9ad4, 0x02077cca194a0629, 14516},
+            {0xc6b3de56db4aef75, 0xc11b18bd25918c30, 14542},
+            {0x940b83f23a55842a, 0x9dbaa465efe141a1, 14569},
+            {0xdc9aadc83b592c5e, 0xc1c35d976ee42c3c, 14595},
+            {0xa45cea2590d0cbd6, 0x0ef123278b35b641, 14622},
+            {0xf4eb7d1ee4ac0571, 0x538966169d82143a, 14648},
+            {0xb67ac26a400b76f3, 0x9be77d1cee450a3a, 14675},
+            {0x87f53540f9dcd2b5, 0x977ac05849b9d613, 14702},
+            {0xca97cd2ff7a30392, 0x3c3e17ac3f323525, 14728},
+            {0x96f18b1742aad751, 0x888c9ab2fc5b3437, 14755},
+            {0xe0ec62f733e55333, 0xfc45a6480c26c68d, 14781},
+            {0xa794bb29b26d36a6, 0x59cf74184ab6b55c, 14808},
+            {0xf9b71229f8e29a22, 0x7f4d6f7a6f9b043c, 14834},
+            {0xba0d61235fd033eb, 0x1f1545846aae50ef, 14861},
+            {0x8a9ea72d433b4f68, 0xa83a0119fd1c456b, 14888},
+            {0xce8f3bd4641219ca, 0xcf4758e2b22837d7, 14914},
+            {0x99e6196979b978f1, 0xba00864671d10540, 14941},
+            {0xe553be2769f4765e, 0xd15e6695e9fb0b3f, 14967},
+            {0xaadcad4b5d5a2c9f, 0xdbd1aba26692e3f4, 14994},
+            {0xfe9ab0119095ce05, 0x603e0dad91b14bc2, 15020},
+            {0xbdb1e819ac378efe, 0x032167c09f4e46a4, 15047},
+            {0x8d55709fbdaeea74, 0x7abcd7ed54a929d3, 15074},
+            {0xd29a8bffe4562c58, 0xfbe1b490a43ac7b5, 15100},
+            {0x9ce977ba0ce3a0bd, 0x61d59d402aae4fea, 15127},
+            {0xe9d12bda62535426, 0x1b901f9f9ce97951, 15153},
+            {0xae3511626ed559f0, 0x7ef5f8c1b3a0771c, 15180},
+            {0x81cb67a674b80b49, 0x3615db2130a938b3, 15207},
+            {0xc168b10e2ba63c3f, 0x42a22ee493c2f4df, 15233},
+            {0x9019d477a0ef343f, 0xf971363c5b63c761, 15260},
+            {0xd6ba215817b5591f, 0x814a69258ddd6d5a, 15286},
+            {0x9ffbf04722750449, 0x803c1cd864033781, 15313},
+            {0xee651ab17bb216d8, 0xa75ff32a997dc41e, 15339},
+            {0xb19e39dbf77b3333, 0xd62f35dc2f99631a, 15366},
+            {0x8455f5578672ad69, 0x796ecf6adfc25225, 15393},
+            {0xc5321783c1759373, 0xee8534fefcf7cf48, 15419},
+            {0x92ec16e35147cdf7, 0x069884f8d1a19173, 15446},
+            {0xdaee6176103ecb83, 0x2419d70ac5dded9d, 15472},
+            {0xa31dcec2fef14b30, 0xa28a151725a55e11, 15499},
+            {0xf30ffb7894855dbe, 0xf37fdabfdb268bec, 15525},
+            {0xb5187ac22a372015, 0x3cab94af04e3878d, 15552},
+            {0x86ed3fb951442f92, 0x36a28df088be564e, 15579},
+            {0xc90e78c7fcbee713, 0xf3be171a27bf81db, 15605},
+            {0x95cc7d66ef8c4b4a, 0x5e709336239897fc, 15632},
+            {0xdf37b3f01a1dd1b4, 0x0c3c6778b928529f, 15658},
+            {0xa64f605b4e3352cd, 0x5b8452af2302fe14, 15685},
+            {0xf7d24130e645ddd7, 0x462a2bf67ddfa64b, 15711},
+            {0xb8a429c472f712bd, 0x6be5bc5e7fef3d66, 15738},
+            {0x899186a2fed05bb9, 0x3b876c012fe55341, 15765},
+            {0xccfe33fc134c49e1, 0xc35ac21a3fd70c60, 15791},
+            {0x98bb4ee309f04d45, 0x5a050b215eebc517, 15818},
+            {0xe3968263b3f00e20, 0x82cd0a6f24b1ba92, 15844},
+            {0xa990f3c09110c544, 0x82b84cabc828bf94, 15871},
+            {0xfcac611c171a19b7, 0x9ffab12dac956a43, 15897},
+            {0xbc419e3fb5e9d924, 0x6ecc7f9959c7582a, 15924},
+            {0x8c430b2bb3951da1, 0xbc21b2bb15330d0d, 15951},
+            {0xd101aa1e098c07e4, 0xe036c5d4a2edafa8, 15977},
+            {0x9bb8d39b6e68b1e3, 0x2b79eb13f1cea349, 16004},
+            {0xe80b387fb9146d6c, 0xa6a99ee15afede54, 16030},
+            {0xace2d92db0390b59, 0x8d29dd5122e4278d, 16057},
+            {0x80cf6963c17d7657, 0xedf3eea5fb251945, 16084},
+            {0xbff13146b8135c4f, 0xb3f19001e03d6ec8, 16110},
+            {0x8f020fb0d2b663bd, 0x5d9f64c557ce815e, 16137},
+            {0xd5193e1208686c9d, 0x2e097318c960d548, 16163},
+            {0x9ec5553e1f3dee59, 0x792c781e1a0cda95, 16190},
+            {0xec96440ebeed5892, 0x5ede59e838e8ddd9, 16216},
+            {0xb045626fb50a35e7, 0x58f8fde02c03a6c7, 16243},
+            {0x8355080bdeb47e22, 0x90ab0e65f1070df7, 16270},
+            {0xc3b33daab205fc01, 0xb10b08c73b19f758, 16296},
+            {0x91ced7dc613083af, 0x12246abfb1459408, 16323},
+            {0xd94554abe1e9db05, 0x68fc787a6f5f923f, 16349},
+            {0xa1e11eea6a7af488, 0x174527f2e7a206a6, 16376},
+        };
+    #endif
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,344 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_FIELD_HPP__
+#define __DCONV_FIELD_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+
+// C.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dconv
+{
+    namespace details
+    {
+        /**
+         * @brief character classes of a fixed width field (bit i is set when character i matches).
+         */
+        struct FieldMasks
+        {
+            uint64_t digit = 0;
+            uint64_t zero  = 0;
+            uint64_t space = 0;
+            uint64_t dot   = 0;
+            uint64_t plus  = 0;
+            uint64_t minus = 0;
+        };
+
+    #if defined(__SSE2__)
+        /**
+         * @brief classify 16 characters.
+         * @param c characters to classify.
+         * @param pos position of the first character in the field.
+         * @param masks character classes to update.
+         */
+        inline void classify (__m128i c, size_t pos, FieldMasks& masks) noexcept
+        {
+            const __m128i d = _mm_sub_epi8 (c, _mm_set1_epi8 ('0'));
+
+            masks.digit |= static_cast <uint64_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_min_epu8 (d, _mm_set1_epi8 (9)), d))) << pos;
+            masks.zero  |= static_cast <uint64_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('0')))) << pos;
+            masks.space |= static_cast <uint64_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 (' ')))) << pos;
+            masks.dot   |= static_cast <uint64_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('.')))) << pos;
+            masks.plus  |= static_cast <uint64_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('+')))) << pos;
+            masks.minus |= static_cast <uint64_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('-')))) << pos;
+        }
+
+        /**
+         * @brief load the first 16 characters of a field.
+         * @param str field characters.
+         * @return loaded characters, zero filled past the field end.
+         */
+        template <size_t N>
+        inline __m128i loadShort (const char* str) noexcept
+        {
+            // first 16 field bytes without reading past the field, zero filled.
+            if (N >= 16)
+            {
+                return _mm_loadu_si128 (reinterpret_cast <const __m128i*> (str));
+            }
+
+            if (N >= 8)
+            {
+                const __m128i hi = _mm_loadl_epi64 (reinterpret_cast <const __m128i*> (str + N - 8));
+                return _mm_or_si128 (_mm_loadl_epi64 (reinterpret_cast <const __m128i*> (str)), _mm_slli_si128 (hi, (N - 8) & 15));
+            }
+
+            if (N >= 4)
+            {
+                uint32_t lo, hi;
+                memcpy (&lo, str, sizeof (lo));
+                memcpy (&hi, str + N - 4, sizeof (hi));
+                return _mm_or_si128 (_mm_cvtsi32_si128 (static_cast <int> (lo)), _mm_slli_si128 (_mm_cvtsi32_si128 (static_cast <int> (hi)), (N - 4) & 15));
+            }
+
+            uint32_t lo = 0;
+            memcpy (&lo, str, (N < 4) ? N : 4);
+            return _mm_cvtsi32_si128 (static_cast <int> (lo));
+        }
+
+        /**
+         * @brief convert the digits of a 16 characters block, skipping the dot.
+         * @param block characters to convert, non digits count as zero.
+         * @param dot position of the dot in the block.
+         * @return converted value.
+         */
+        inline uint64_t parseBlock (__m128i block, int64_t dot) noexcept
+        {
+            // digit values, zero elsewhere, with the digits before the dot moved one position right.
+            const __m128i iota = _mm_setr_epi8 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __m128i v = _mm_sub_epi8 (block, _mm_set1_epi8 ('0'));
+            v = _mm_and_si128 (v, _mm_cmpeq_epi8 (_mm_min_epu8 (v, _mm_set1_epi8 (9)), v));
+            const __m128i before = _mm_cmplt_epi8 (iota, _mm_set1_epi8 (static_cast <char> (dot + 1)));
+            v = _mm_or_si128 (_mm_and_si128 (before, _mm_slli_si128 (v, 1)), _mm_andnot_si128 (before, v));
+
+            // 16 digits number, combining pairs, quads and octets.
+            const __m128i pairs = _mm_packs_epi32 (
+                _mm_madd_epi16 (_mm_unpacklo_epi8 (v, _mm_setzero_si128 ()), _mm_setr_epi16 (10, 1, 10, 1, 10, 1, 10, 1)),
+                _mm_madd_epi16 (_mm_unpackhi_epi8 (v, _mm_setzero_si128 ()), _mm_setr_epi16 (10, 1, 10, 1, 10, 1, 10, 1)));
+            const __m128i quads = _mm_madd_epi16 (pairs, _mm_setr_epi16 (100, 1, 100, 1, 100, 1, 100, 1));
+            const __m128i octets = _mm_madd_epi16 (_mm_packs_epi32 (quads, quads), _mm_setr_epi16 (10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+            return (static_cast <uint64_t> (_mm_cvtsi128_si32 (octets)) * 100000000) + static_cast <uint32_t> (_mm_cvtsi128_si32 (_mm_srli_si128 (octets, 4)));
+        }
+    #endif
+
+        /**
+         * @brief classify the characters of a field.
+         * @param str field characters.
+         * @param masks character classes to update.
+         */
+        template <size_t N>
+        inline void classify (const char* str, FieldMasks& masks) noexcept
+        {
+        #if defined(__SSE2__)
+            size_t i = 0;
+
+            for (; i + 16 <= N; i += 16)
+            {
+                classify (_mm_loadu_si128 (reinterpret_cast <const __m128i*> (str + i)), i, masks);
+            }
+
+            if ((N % 16) && (N > 16))
+            {
+                // reload the last 16 bytes and drop the ones already classified.
+                const __m128i c = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (str + N - 16));
+                classify (_mm_srli_si128 (c, (16 - (N % 16)) % 16), i, masks);
+            }
+            else if (N % 16)
+            {
+                alignas (16) char field[16] = {};
+                memcpy (field, str, N % 16);
+                classify (_mm_load_si128 (reinterpret_cast <const __m128i*> (field)), 0, masks);
+            }
+
+            // zero bytes shifted in past the field end match no class.
+        #else
+            for (size_t i = 0; i < N; ++i)
+            {
+                const uint8_t c = static_cast <uint8_t> (str[i]);
+                masks.digit |= static_cast <uint64_t> (static_cast <uint8_t> (c - '0') < 10) << i;
+                masks.zero  |= static_cast <uint64_t> (c == '0') << i;
+                masks.space |= static_cast <uint64_t> (c == ' ') << i;
+                masks.dot   |= static_cast <uint64_t> (c == '.') << i;
+                masks.plus  |= static_cast <uint64_t> (c == '+') << i;
+                masks.minus |= static_cast <uint64_t> (c == '-') << i;
+            }
+        #endif
+        }
+
+        /**
+         * @brief convert a run of up to 24 digits ending at a given position.
+         * @param str field characters.
+         * @param head first 8 field characters, used by fields shorter than 8 characters.
+         * @param beg run first position.
+         * @param end position after the run.
+         * @return converted value.
+         */
+        template <size_t N>
+        inline uint64_t parseRun (const char* str, uint64_t head, int64_t beg, int64_t end) noexcept
+        {
+            // chunk bytes located before the run are replaced by '0'.
+            static constexpr uint64_t keep[] = {
+                0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFF000000ULL, 0xFFFFFFFF00000000ULL,
+                0xFFFFFF0000000000ULL, 0xFFFF000000000000ULL, 0xFF00000000000000ULL, 0x0000000000000000ULL
+            };
+
+            uint64_t value = 0;
+
+            for (int64_t k = 0; k < 3; ++k)
+            {
+                // load the chunk ending 8 * (2 - k) bytes before the run end without branches,
+                // bytes located before the field are shifted out as zeros.
+                const int64_t offset = end - 24 + (8 * k);
+                const int64_t load = (offset < 0) ? 0 : offset;
+                const uint64_t shift = 8 * static_cast <uint64_t> (load - offset);
+
+                uint64_t chunk = (N >= 8) ? loadChunk (str + load) : head;
+                chunk = (chunk << (shift & 63)) & (0 - static_cast <uint64_t> (shift < 64));
+
+                int64_t skip = beg - offset;
+                skip = (skip < 0) ? 0 : ((skip > 8) ? 8 : skip);
+                chunk = (chunk & keep[skip]) | (0x3030303030303030ULL & ~keep[skip]);
+
+                value = (value * 100000000) + parseEightDigits (chunk);
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief fixed width field to double conversion.
+         * @param str field characters.
+         * @param value converted value.
+         * @return end of the field on success, nullptr on failure.
+         */
+        template <size_t N>
+        inline const char* atodFixed (const char* str, double& value) noexcept
+        {
+            static constexpr uint64_t pow10[] = {
+                1ULL,                 10ULL,                 100ULL,                 1000ULL,
+                10000ULL,             100000ULL,             1000000ULL,             10000000ULL,
+                100000000ULL,         1000000000ULL,         10000000000ULL,         100000000000ULL,
+                1000000000000ULL,     10000000000000ULL,     100000000000000ULL,     1000000000000000ULL,
+                10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+            };
+
+            constexpr uint64_t full = (N == 64) ? ~uint64_t (0) : (uint64_t (1) << N) - 1;
+
+            FieldMasks masks;
+        #if defined(__SSE2__)
+            const __m128i head = (N < 16) ? loadShort <N> (str) : _mm_setzero_si128 ();
+            if (N < 16)
+            {
+                classify (head, 0, masks);
+            }
+            else
+        #endif
+            {
+                classify <N> (str, masks);
+            }
+
+            const uint64_t sign    = masks.plus | masks.minus;
+            const uint64_t content = full & ~masks.space;
+            const uint64_t first   = content & (0 - content);
+            const uint64_t run     = content + first;
+
+            // only spaces, digits, one dot and one leading sign, with spaces around the content only.
+            const bool invalid = ((masks.digit | masks.space | masks.dot | sign) != full) ||
+                                 (masks.digit == 0) ||
+                                 ((run & (run - 1)) != 0) ||
+                                 ((sign & ~first) != 0) ||
+                                 ((masks.dot & (masks.dot - 1)) != 0);
+
+            if (unlikely (invalid))
+            {
+                return nullptr;
+            }
+
+            const int64_t beg = __builtin_ctzll (content) + (sign != 0);
+            const int64_t end = 64 - __builtin_clzll (content);
+            const int64_t dot = masks.dot ? __builtin_ctzll (masks.dot) : end;
+            const int64_t fraction = (dot < end) ? dot + 1 : end;
+
+            // digits from the first non zero one, leading zeros are not significant.
+            const uint64_t significant = masks.digit & ~masks.zero;
+            const int64_t lead = significant ? __builtin_ctzll (significant) : end;
+            const int64_t digits = end - lead - ((dot < end) && (dot > lead));
+
+        #if defined(__SSE2__)
+            // the 16 bytes ending at the content end must hold the dot and all the significant digits,
+            // positions past the content end count as trailing zeros.
+            const int64_t pos = (end > 16) ? end - 16 : 0;
+
+            if ((pos == 0) || (((significant | masks.dot) & ((uint64_t (1) << pos) - 1)) == 0))
+            {
+                const __m128i block = (N < 16) ? head : _mm_loadu_si128 (reinterpret_cast <const __m128i*> (str + pos));
+                const uint64_t significand = parseBlock (block, (dot < end) ? dot - pos : -1);
+
+                if (strtodFast (masks.minus != 0, significand, fraction - pos - 16, value))
+                {
+                    return str + N;
+                }
+            }
+            else
+        #endif
+            if (likely (digits <= 19))
+            {
+                // first field bytes, used by the chunks that start before the field.
+                uint64_t head = 0;
+                memcpy (&head, str, (N < 8) ? N : 8);
+            #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                head = __builtin_bswap64 (head);
+            #endif
+
+                const int64_t scale = end - fraction;
+                const uint64_t significand = (parseRun <N> (str, head, beg, dot) * pow10[(scale < 19) ? scale : 19]) + parseRun <N> (str, head, fraction, end);
+
+                if (strtodFast (masks.minus != 0, significand, -scale, value))
+                {
+                    return str + N;
+                }
+            }
+
+            char buffer[N + 1];
+            const size_t len = end - beg + (sign != 0);
+            memcpy (buffer, str + beg - (sign != 0), len);
+            buffer[len] = '\0';
+
+            if (strtodSlow (View (buffer, len), value) != buffer + len)
+            {
+                return nullptr;
+            }
+
+            return str + N;
+        }
+    }
+
+    /**
+     * @brief fixed width field to double conversion.
+     * @param str field of exactly N characters, not necessarily null terminated.
+     * @param value converted value.
+     * @return end of the field on success, nullptr on failure.
+     *
+     * the field holds an optional sign, digits and an optional decimal point,
+     * padded with spaces on either side. leading zeros are allowed.
+     */
+    template <size_t N>
+    inline const char* atodFixed (const char* str, double& value) noexcept
+    {
+        static_assert ((N > 0) && (N <= 64), "field width must be in [1, 64]");
+        return details::atodFixed <N> (str, value);
+    }
+}
+
+#endif
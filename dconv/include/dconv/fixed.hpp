@@ -0,0 +1,234 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_FIXED_HPP__
+#define __DCONV_FIXED_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+// C.
+#include <cstdint>
+
+namespace dconv
+{
+    /**
+     * @brief fixed point printing flags.
+     */
+    enum FixedFlags
+    {
+        FixedDefault   = 0,         /**< print all the scale digits. */
+        FixedTrimZeros = 1 << 0,    /**< remove trailing zeros of the fractional part. */
+    };
+
+    namespace details
+    {
+        /**
+         * @brief get the first significant digit dropped by accumulate.
+         * @param first number first position.
+         * @param last number last position.
+         * @param sticky set if a non zero digit follows the first dropped one.
+         * @return first dropped digit.
+         */
+        inline int droppedDigit (const char* first, const char* last, bool& sticky) noexcept
+        {
+            int dropped = 0;
+            int digits = 0;
+            sticky = false;
+
+            for (; (first != last) && (*first != 'e') && (*first != 'E'); ++first)
+            {
+                if (!isDigit (*first) || ((digits == 0) && (*first == '0')))
+                {
+                    continue;
+                }
+
+                if (digits < 19)
+                {
+                    ++digits;
+                }
+                else if (digits == 19)
+                {
+                    dropped = *first - '0';
+                    ++digits;
+                }
+                else
+                {
+                    sticky |= (*first != '0');
+                }
+            }
+
+            return dropped;
+        }
+
+        inline const char * atofixed (View& view, int scale, int64_t& value) noexcept
+        {
+            static constexpr uint64_t pow10[] = {
+                1ULL,                 10ULL,                 100ULL,                 1000ULL,
+                10000ULL,             100000ULL,             1000000ULL,             10000000ULL,
+                100000000ULL,         1000000000ULL,         10000000000ULL,         100000000000ULL,
+                1000000000000ULL,     10000000000000ULL,     100000000000000ULL,     1000000000000000ULL,
+                10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+            };
+
+            uint64_t significand;
+            int64_t exponent;
+            bool truncated;
+            bool neg;
+
+            const View beg (view);
+
+            if (unlikely (!isFinite (accumulate (view, neg, significand, exponent, truncated))))
+            {
+                return nullptr;
+            }
+
+            exponent += scale;
+
+            if (exponent >= 0)
+            {
+                if (significand && ((exponent > 19) || __builtin_mul_overflow (significand, pow10[exponent], &significand)))
+                {
+                    return nullptr;
+                }
+
+                // 19 digits scaled up always overflow, so dropped digits are right below the unit here.
+                if (unlikely (truncated) && (exponent == 0))
+                {
+                    bool sticky;
+                    const int dropped = droppedDigit (beg.data (), view.data (), sticky);
+
+                    if ((dropped > 5) || ((dropped == 5) && (sticky || (significand & 1))))
+                    {
+                        ++significand;
+                    }
+                }
+            }
+            else if (exponent < -19)
+            {
+                significand = 0;
+            }
+            else
+            {
+                const uint64_t divisor = pow10[-exponent];
+                const uint64_t remainder = significand % divisor;
+                significand /= divisor;
+
+                // round half to even, dropped digits put a half remainder above the halfway point.
+                if ((remainder > divisor - remainder) || ((remainder == divisor - remainder) && (truncated || (significand & 1))))
+                {
+                    ++significand;
+                }
+            }
+
+            if (unlikely (significand > static_cast <uint64_t> (INT64_MAX) + neg))
+            {
+                return nullptr;
+            }
+
+            value = neg ? static_cast <int64_t> (0 - significand) : static_cast <int64_t> (significand);
+            return view.data ();
+        }
+    }
+
+    /**
+     * @brief fixed point to string conversion.
+     * @param buffer buffer to write the string representation to (at least 23 + |scale| characters).
+     * @param value scaled value.
+     * @param scale number of decimal digits of the fixed point unit (value is divided by 10^scale).
+     * @param flags printing flags.
+     * @return end position.
+     */
+    inline char* fixedtoa (char* buffer, int64_t value, int scale, int flags = FixedDefault)
+    {
+        bool is_negative = value < 0;
+        uint64_t significand = is_negative ? 0 - static_cast <uint64_t> (value) : static_cast <uint64_t> (value);
+
+        *buffer = '-';
+        buffer += is_negative;
+
+        int k = -scale;
+
+        if (flags & FixedTrimZeros)
+        {
+            if (significand == 0)
+            {
+                k = 0;
+            }
+
+            while ((k < 0) && significand && ((significand % 10) == 0))
+            {
+                significand /= 10;
+                ++k;
+            }
+        }
+
+        int length = details::writeDigits (buffer, significand);
+        return details::positional (buffer, length, length + k);
+    }
+
+    /**
+     * @brief string to fixed point conversion.
+     * @param str string to parse.
+     * @param scale number of decimal digits of the fixed point unit (value is scaled by 10^scale).
+     * @param value converted value, rounded half to even.
+     * @return end position on success, nullptr on failure or overflow.
+     */
+    inline const char* atofixed (const char* str, int scale, int64_t& value) noexcept
+    {
+        View view (str);
+        return details::atofixed (view, scale, value);
+    }
+
+    /**
+     * @brief string to fixed point conversion.
+     * @param str string to parse.
+     * @param length string length.
+     * @param scale number of decimal digits of the fixed point unit (value is scaled by 10^scale).
+     * @param value converted value, rounded half to even.
+     * @return end position on success, nullptr on failure or overflow.
+     */
+    inline const char* atofixed (const char* str, size_t length, int scale, int64_t& value) noexcept
+    {
+        View view (str, length);
+        return details::atofixed (view, scale, value);
+    }
+
+    /**
+     * @brief string to fixed point conversion.
+     * @param first string first position.
+     * @param last string last position.
+     * @param scale number of decimal digits of the fixed point unit (value is scaled by 10^scale).
+     * @param value converted value, rounded half to even.
+     * @return end position on success, nullptr on failure or overflow.
+     */
+    inline const char* atofixed (const char* first, const char* last, int scale, int64_t& value) noexcept
+    {
+        View view (first, last);
+        return details::atofixed (view, scale, value);
+    }
+}
+
+#endif
@@ -0,0 +1,520 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_HALF_HPP__
+#define __DCONV_HALF_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+// C++.
+#include <limits>
+
+// C.
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+namespace dconv
+{
+    /**
+     * @brief 16 bits IEEE like floating point, stored as its bit pattern.
+     */
+    template <int FractionSize, int ExponentSize>
+    class NarrowFloat
+    {
+        static_assert (1 + ExponentSize + FractionSize == 16, "narrow floating point must be 16 bits wide");
+
+    public:
+        /// stored fraction size.
+        static constexpr int _fractionSize = FractionSize;
+
+        /// exponent size.
+        static constexpr int _exponentSize = ExponentSize;
+
+        /// exponent bias.
+        static constexpr int _exponentBias = (1 << (ExponentSize - 1)) - 1;
+
+        /// biased exponent of infinity.
+        static constexpr int _maxExponent = (1 << ExponentSize) - 1;
+
+        /**
+         * @brief default constructor (positive zero).
+         */
+        constexpr NarrowFloat () noexcept = default;
+
+        /**
+         * @brief create a narrow floating point by rounding a double to nearest even.
+         * @param value double value.
+         */
+        explicit NarrowFloat (double value) noexcept;
+
+        /**
+         * @brief convert to double (exact).
+         * @return double value.
+         */
+        explicit operator double () const noexcept;
+
+        /**
+         * @brief create a narrow floating point from its bit pattern.
+         * @param bits bit pattern.
+         * @return narrow floating point.
+         */
+        static constexpr NarrowFloat fromBits (uint16_t bits) noexcept
+        {
+            return NarrowFloat (bits, 0);
+        }
+
+        /**
+         * @brief get the bit pattern.
+         * @return bit pattern.
+         */
+        constexpr uint16_t bits () const noexcept
+        {
+            return _bits;
+        }
+
+    private:
+        /**
+         * @brief create a narrow floating point from its bit pattern.
+         * @param bits bit pattern.
+         */
+        constexpr NarrowFloat (uint16_t bits, int) noexcept
+        : _bits (bits)
+        {
+        }
+
+        /// bit pattern.
+        uint16_t _bits = 0;
+    };
+
+    /**
+     * @brief IEEE 754 binary16.
+     */
+    using Half = NarrowFloat <10, 5>;
+
+    /**
+     * @brief brain floating point (binary32 truncated to 16 bits).
+     */
+    using BFloat16 = NarrowFloat <7, 8>;
+
+    namespace details
+    {
+        /**
+         * @brief narrow floating point definitions, shared with the wide ones by the exact conversion.
+         */
+        template <int FractionSize, int ExponentSize>
+        struct Wide <NarrowFloat <FractionSize, ExponentSize>>
+        {
+            using Narrow = NarrowFloat <FractionSize, ExponentSize>;
+
+            /// mantissa size (hidden bit included).
+            static constexpr int _mantissaSize = FractionSize + 1;
+
+            /// stored fraction size.
+            static constexpr int _fractionSize = FractionSize;
+
+            /// exponent bias.
+            static constexpr int _exponentBias = Narrow::_exponentBias + FractionSize;
+
+            /// biased exponent of infinity.
+            static constexpr int _maxExponent = Narrow::_maxExponent;
+
+            /// hidden bit.
+            static constexpr WideUInt _hiddenBit = static_cast <WideUInt> (1) << FractionSize;
+
+            /**
+             * @brief build a narrow floating point from its components.
+             * @param negative sign.
+             * @param exponent biased exponent.
+             * @param mantissa mantissa (hidden bit included).
+             * @return narrow floating point.
+             */
+            static Narrow fromBits (bool negative, int exponent, WideUInt mantissa) noexcept
+            {
+                return Narrow::fromBits (static_cast <uint16_t> ((static_cast <unsigned> (negative) << 15) |
+                                                                 (static_cast <unsigned> (exponent) << FractionSize) |
+                                                                 (static_cast <unsigned> (mantissa) & ((1u << FractionSize) - 1))));
+            }
+        };
+
+        /**
+         * @brief fast path conversion to a narrow floating point.
+         *
+         * the product of the significand by the power of ten is rounded once, at the narrow precision.
+         */
+        template <typename Narrow>
+        inline bool strtohFast (bool negative, uint64_t significand, int64_t exponent, Narrow& value) noexcept
+        {
+            constexpr int fraction = Narrow::_fractionSize;
+            const uint64_t sign = static_cast <uint64_t> (negative) << 15;
+
+            if (unlikely ((significand == 0) || (exponent < -325)))
+            {
+                value = Narrow::fromBits (static_cast <uint16_t> (sign));
+                return true;
+            }
+
+            if (unlikely (exponent > 308))
+            {
+                value = Narrow::fromBits (static_cast <uint16_t> (sign | (Narrow::_maxExponent << fraction)));
+                return true;
+            }
+
+            uint64_t high, middle, low;
+            const Power& power = atodpow[exponent + 325];
+            umul192 (power.hi, power.lo, significand, high, middle, low);
+
+            int lz = high ? __builtin_clzll (high) : 64 + __builtin_clzll (middle);
+
+            if (high == 0)
+            {
+                high = (middle << (lz - 64)) | ((lz > 64) ? (low >> (128 - lz)) : 0);
+                middle = low << (lz - 64);
+                low = 0;
+            }
+            else if (lz != 0)
+            {
+                high = (high << lz) | (middle >> (64 - lz));
+                middle = (middle << lz) | (low >> (64 - lz));
+                low <<= lz;
+            }
+
+            const int64_t biased = ((exponent * 217706) >> 16) + 64 - lz + Narrow::_exponentBias;
+
+            if (unlikely (biased >= Narrow::_maxExponent))
+            {
+                value = Narrow::fromBits (static_cast <uint16_t> (sign | (Narrow::_maxExponent << fraction)));
+                return true;
+            }
+
+            // subnormals are rounded further right.
+            const int64_t shift = 63 - fraction + ((biased < 1) ? 1 - biased : 0);
+
+            if (unlikely (shift > 64))
+            {
+                value = Narrow::fromBits (static_cast <uint16_t> (sign));
+                return true;
+            }
+
+            // below the smallest subnormal, the whole high word is the rest.
+            const uint64_t half = static_cast <uint64_t> (1) << (shift - 1);
+            const uint64_t rest = (shift == 64) ? high : (high & ((half << 1) - 1));
+            const uint64_t mant = (shift == 64) ? 0 : (high >> shift);
+            bool roundUp;
+
+            if (unlikely (!roundProduct (exponent, rest, half, middle, low, mant & 1, roundUp)))
+            {
+                return false;
+            }
+
+            // the hidden bit of normals carries into the exponent, and so does the rounding.
+            uint64_t bits = ((biased >= 1) ? (static_cast <uint64_t> (biased - 1) << fraction) : 0) + mant + roundUp;
+
+            if (bits >= (static_cast <uint64_t> (Narrow::_maxExponent) << fraction))
+            {
+                bits = static_cast <uint64_t> (Narrow::_maxExponent) << fraction;
+            }
+
+            value = Narrow::fromBits (static_cast <uint16_t> (sign | bits));
+            return true;
+        }
+
+        /**
+         * @brief string to narrow floating point conversion.
+         * @param view view positioned at the number, moved past it on success.
+         * @param value converted value.
+         * @return end position on success, nullptr on failure.
+         */
+        template <typename Narrow>
+        inline const char* atoh (View& view, Narrow& value)
+        {
+            constexpr int fraction = Narrow::_fractionSize;
+            const View beg (view);
+
+            uint64_t significand;
+            int64_t exponent;
+            bool truncated;
+            bool neg;
+
+            switch (accumulate (view, neg, significand, exponent, truncated))
+            {
+                case Token::Integer:
+                case Token::Number:
+                    break;
+                case Token::Infinity:
+                    value = Narrow::fromBits (static_cast <uint16_t> ((neg << 15) | (Narrow::_maxExponent << fraction)));
+                    return view.data ();
+                case Token::NaN:
+                    value = Narrow::fromBits (static_cast <uint16_t> ((neg << 15) | (Narrow::_maxExponent << fraction) | (1 << (fraction - 1))));
+                    return view.data ();
+                default:
+                    return nullptr;
+            }
+
+            // dropped non zero digits put the value strictly between significand and significand + 1.
+            Narrow upper;
+
+            if (likely (strtohFast (neg, significand, exponent, value) &&
+                        (!truncated || (strtohFast (neg, significand + 1, exponent, upper) && (value.bits () == upper.bits ())))))
+            {
+                return view.data ();
+            }
+
+            return strtodExact (beg, value);
+        }
+
+        /**
+         * @brief shorten digits that lie on a boundary of the rounding interval.
+         *
+         * grisu excludes the boundaries, but they round to the value when its mantissa is even.
+         * shorter candidates are checked by parsing them back.
+         */
+        template <typename Narrow>
+        inline void shorten (char* digits, int& length, int& k, Narrow value)
+        {
+            while (length > 1)
+            {
+                bool found = false;
+
+                for (int up = 0; (up < 2) && !found; ++up)
+                {
+                    char candidate[32];
+                    int n = length - 1, kk = k + 1;
+                    memcpy (candidate, digits, n);
+
+                    if (up)
+                    {
+                        int i = n - 1;
+                        while ((i >= 0) && (candidate[i] == '9'))
+                        {
+                            candidate[i--] = '0';
+                        }
+                        if (i < 0)
+                        {
+                            candidate[0] = '1';
+                            ++kk;
+                        }
+                        else
+                        {
+                            ++candidate[i];
+                        }
+                    }
+
+                    candidate[n] = 'e';
+                    View view (candidate, writeExponent (candidate + n + 1, kk));
+                    Narrow parsed;
+
+                    if (atoh (view, parsed) && (parsed.bits () == value.bits ()))
+                    {
+                        memcpy (digits, candidate, n);
+                        length = n;
+                        k = kk;
+                        found = true;
+                    }
+                }
+
+                if (!found)
+                {
+                    break;
+                }
+
+                while ((length > 1) && (digits[length - 1] == '0'))
+                {
+                    --length;
+                    ++k;
+                }
+            }
+        }
+
+        /**
+         * @brief narrow floating point to string conversion.
+         * @param buffer buffer to write the string representation to.
+         * @param value value to convert.
+         * @return end position.
+         */
+        template <typename Narrow>
+        inline char* htoa (char* buffer, Narrow value)
+        {
+            constexpr int fraction = Narrow::_fractionSize;
+            const uint64_t hidden = static_cast <uint64_t> (1) << fraction;
+
+            const int exp = (value.bits () >> fraction) & Narrow::_maxExponent;
+            uint64_t mant = value.bits () & (hidden - 1);
+
+            if (unlikely (exp == Narrow::_maxExponent) && mant)
+            {
+                memcpy (buffer, "nan", 3);
+                return buffer + 3;
+            }
+
+            *buffer = '-';
+            buffer += (value.bits () >> 15);
+
+            if (unlikely (exp == Narrow::_maxExponent))
+            {
+                memcpy (buffer, "inf", 3);
+                return buffer + 3;
+            }
+
+            if ((exp == 0) && (mant == 0))
+            {
+                return writeZero (buffer);
+            }
+
+            int e = 1 - Narrow::_exponentBias - fraction;
+
+            if (exp)
+            {
+                mant |= hidden;
+                e += exp - 1;
+            }
+
+            // boundaries are the midpoints with the neighbours, the lower one is closer at a power of two.
+            DiyFp val (mant, e), plus ((mant << 1) + 1, e - 1);
+            plus.normalize ();
+
+            const bool lower = (mant == hidden) && (exp > 1);
+            DiyFp minus (lower ? (mant << 2) - 1 : (mant << 1) - 1, lower ? e - 2 : e - 1);
+            minus._mantissa <<= minus._exponent - plus._exponent;
+            minus._exponent = plus._exponent;
+
+            int length = 0, k = 0;
+            grisu2 (buffer, length, k, val.normalize (), minus, plus);
+
+            // below one, a boundary ends with a non zero digit at 10^(e - 1), shorter digits can't reach it.
+            if (((mant & 1) == 0) && ((e >= 1) || (k + 2 <= e)))
+            {
+                shorten (buffer, length, k, Narrow::fromBits (value.bits () & 0x7FFF));
+            }
+
+            return prettify (buffer, length, k);
+        }
+    }
+
+    template <int FractionSize, int ExponentSize>
+    NarrowFloat <FractionSize, ExponentSize>::NarrowFloat (double value) noexcept
+    {
+        using Format = details::Wide <NarrowFloat>;
+
+        uint64_t bits;
+        memcpy (&bits, &value, sizeof (double));
+
+        const bool negative = bits >> 63;
+        const int exp = static_cast <int> ((bits >> 52) & 0x7FF);
+        const uint64_t mant = bits & 0xFFFFFFFFFFFFF;
+
+        if (exp == 0x7FF)
+        {
+            _bits = Format::fromBits (negative, _maxExponent, mant ? (1u << (FractionSize - 1)) : 0).bits ();
+        }
+        else if ((exp == 0) && (mant == 0))
+        {
+            _bits = Format::fromBits (negative, 0, 0).bits ();
+        }
+        else
+        {
+            _bits = details::assemble <NarrowFloat> (negative, exp ? (mant | (static_cast <uint64_t> (1) << 52)) : mant, (exp ? exp : 1) - 1075, false).bits ();
+        }
+    }
+
+    template <int FractionSize, int ExponentSize>
+    NarrowFloat <FractionSize, ExponentSize>::operator double () const noexcept
+    {
+        const int exp = (_bits >> FractionSize) & _maxExponent;
+        const int mant = _bits & ((1 << FractionSize) - 1);
+        double value;
+
+        if (exp == _maxExponent)
+        {
+            value = mant ? std::numeric_limits <double>::quiet_NaN () : std::numeric_limits <double>::infinity ();
+        }
+        else if (exp == 0)
+        {
+            value = std::ldexp (mant, 1 - _exponentBias - FractionSize);
+        }
+        else
+        {
+            value = std::ldexp (mant | (1 << FractionSize), exp - _exponentBias - FractionSize);
+        }
+
+        return (_bits >> 15) ? -value : value;
+    }
+
+    /**
+     * @brief string to narrow floating point conversion.
+     * @param str null-terminated string.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    template <int FractionSize, int ExponentSize>
+    inline const char* atod (const char* str, NarrowFloat <FractionSize, ExponentSize>& value)
+    {
+        View view (str);
+        return details::atoh (view, value);
+    }
+
+    /**
+     * @brief string to narrow floating point conversion.
+     * @param str string.
+     * @param length string length.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    template <int FractionSize, int ExponentSize>
+    inline const char* atod (const char* str, size_t length, NarrowFloat <FractionSize, ExponentSize>& value)
+    {
+        View view (str, length);
+        return details::atoh (view, value);
+    }
+
+    /**
+     * @brief string to narrow floating point conversion.
+     * @param first pointer to the first character of the string.
+     * @param last pointer to the last character of the string.
+     * @param value converted value.
+     * @return end position on success, nullptr on failure.
+     */
+    template <int FractionSize, int ExponentSize>
+    inline const char* atod (const char* first, const char* last, NarrowFloat <FractionSize, ExponentSize>& value)
+    {
+        View view (first, last);
+        return details::atoh (view, value);
+    }
+
+    /**
+     * @brief narrow floating point to string conversion (shortest representation that parses back).
+     * @param buffer buffer to write the string representation to (at least 25 characters).
+     * @param value value to convert.
+     * @return end position.
+     */
+    template <int FractionSize, int ExponentSize>
+    inline char* dtoa (char* buffer, NarrowFloat <FractionSize, ExponentSize> value)
+    {
+        return details::htoa (buffer, value);
+    }
+}
+
+#endif
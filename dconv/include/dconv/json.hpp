@@ -0,0 +1,227 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_JSON_HPP__
+#define __DCONV_JSON_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+
+// C++.
+#include <iterator>
+#include <vector>
+
+// C.
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dconv
+{
+    namespace details
+    {
+        inline constexpr bool isJsonSpace (char c) noexcept
+        {
+            return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+        }
+
+        /**
+         * @brief skip JSON whitespaces.
+         * @param view view to move.
+         */
+        inline void skipJsonSpaces (View& view) noexcept
+        {
+            const char* pos = view.data ();
+            const char* end = pos + view.size ();
+
+            // most separators are followed by at most one whitespace.
+            if (likely ((pos == end) || !isJsonSpace (*pos)))
+            {
+                return;
+            }
+
+            ++pos;
+
+        #if defined(__SSE2__)
+            while (end - pos >= 16)
+            {
+                const __m128i c = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (pos));
+                const __m128i spaces = _mm_or_si128 (
+                    _mm_or_si128 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 (' ')), _mm_cmpeq_epi8 (c, _mm_set1_epi8 ('\n'))),
+                    _mm_or_si128 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 ('\r')), _mm_cmpeq_epi8 (c, _mm_set1_epi8 ('\t'))));
+                const unsigned others = ~static_cast <unsigned> (_mm_movemask_epi8 (spaces)) & 0xFFFF;
+
+                if (others)
+                {
+                    view = View (pos + __builtin_ctz (others), end);
+                    return;
+                }
+
+                pos += 16;
+            }
+        #endif
+
+            while ((pos < end) && isJsonSpace (*pos))
+            {
+                ++pos;
+            }
+
+            view = View (pos, end);
+        }
+
+        /**
+         * @brief count the commas of a string.
+         * @param first string first position.
+         * @param last string last position.
+         * @return number of commas.
+         */
+        inline size_t countCommas (const char* first, const char* last) noexcept
+        {
+            size_t count = 0;
+
+        #if defined(__SSE2__)
+            while (last - first >= 16)
+            {
+                const __m128i c = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (first));
+                count += __builtin_popcount (_mm_movemask_epi8 (_mm_cmpeq_epi8 (c, _mm_set1_epi8 (','))));
+                first += 16;
+            }
+        #endif
+
+            while (first < last)
+            {
+                count += (*first++ == ',');
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief parse a JSON number (no infinity or nan).
+         * @param view view positioned at the number, moved past it on success.
+         * @param value converted value.
+         * @return true on success.
+         */
+        inline bool parseJsonNumber (View& view, double& value)
+        {
+            const View beg (view);
+            const char* end = beg.data () + beg.size ();
+
+            uint64_t significand;
+            int64_t exponent;
+            bool truncated;
+            bool neg;
+
+            if (unlikely (!isFinite (accumulate (view, neg, significand, exponent, truncated))))
+            {
+                return false;
+            }
+
+            if (likely (strtodFast (neg, significand, exponent, truncated, value)))
+            {
+                return true;
+            }
+
+            // strtod needs a terminating character, the closing bracket at least must follow the number.
+            if ((view.data () == end) || (strtodSlow (beg, value) != view.data ()))
+            {
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    /**
+     * @brief parse a JSON array of numbers.
+     * @param first string first position.
+     * @param last string last position.
+     * @param out output iterator receiving the values.
+     * @return position after the closing bracket on success, nullptr on failure.
+     */
+    template <typename OutputIt>
+    const char* parseJsonArray (const char* first, const char* last, OutputIt out)
+    {
+        View view (first, last);
+
+        details::skipJsonSpaces (view);
+
+        if (unlikely (!view.getIf ('[')))
+        {
+            return nullptr;
+        }
+
+        details::skipJsonSpaces (view);
+
+        if (view.getIf (']'))
+        {
+            return view.data ();
+        }
+
+        for (;;)
+        {
+            double value;
+
+            if (unlikely (!details::parseJsonNumber (view, value)))
+            {
+                return nullptr;
+            }
+
+            *out++ = value;
+
+            details::skipJsonSpaces (view);
+
+            if (likely (view.getIf (',')))
+            {
+                details::skipJsonSpaces (view);
+            }
+            else if (view.getIf (']'))
+            {
+                return view.data ();
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    /**
+     * @brief parse a JSON array of numbers, appending the values to a vector.
+     * @param first string first position.
+     * @param last string last position.
+     * @param values vector receiving the values, its capacity is reserved from the commas count.
+     * @return position after the closing bracket on success, nullptr on failure.
+     */
+    inline const char* parseJsonArray (const char* first, const char* last, std::vector <double>& values)
+    {
+        values.reserve (values.size () + details::countCommas (first, last) + 1);
+        return parseJsonArray (first, last, std::back_inserter (values));
+    }
+}
+
+#endif
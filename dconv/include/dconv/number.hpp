@@ -0,0 +1,155 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_NUMBER_HPP__
+#define __DCONV_NUMBER_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+
+// C++.
+#include <limits>
+
+// C.
+#include <cstdint>
+
+namespace dconv
+{
+    /**
+     * @brief parsed number type.
+     */
+    enum NumberType
+    {
+        NumberInt64,        /**< integer that fits in an int64_t. */
+        NumberUInt64,       /**< positive integer that only fits in an uint64_t. */
+        NumberDouble,       /**< number with a fractional part or an exponent, or integer out of range. */
+    };
+
+    /**
+     * @brief parsed number.
+     */
+    struct Number
+    {
+        NumberType _type;       /**< number type. */
+
+        union
+        {
+            int64_t _int64;     /**< value if NumberInt64. */
+            uint64_t _uint64;   /**< value if NumberUInt64. */
+            double _double;     /**< value if NumberDouble. */
+        };
+    };
+
+    /**
+     * @brief parse a number, keeping integers as integers.
+     * @param view view positioned at the number, moved past it on success.
+     * @param number parsed number.
+     * @return true on success, false on grammar error (view is left untouched).
+     */
+    inline bool parseNumber (View& view, Number& number)
+    {
+        const View beg (view);
+
+        uint64_t significand;
+        int64_t exponent;
+        bool truncated;
+        bool neg;
+
+        switch (details::accumulate (view, neg, significand, exponent, truncated))
+        {
+            case details::Token::Integer:
+            {
+                // an uint64_t has up to 20 digits, only the last one may have been dropped.
+                uint64_t integer = significand;
+
+                if ((exponent == 0) || ((exponent == 1) &&
+                    !__builtin_mul_overflow (significand, 10, &integer) &&
+                    !__builtin_add_overflow (integer, static_cast <uint64_t> (view.data ()[-1] - '0'), &integer)))
+                {
+                    if (!neg)
+                    {
+                        if (integer <= static_cast <uint64_t> (std::numeric_limits <int64_t>::max ()))
+                        {
+                            number._type = NumberInt64;
+                            number._int64 = static_cast <int64_t> (integer);
+                        }
+                        else
+                        {
+                            number._type = NumberUInt64;
+                            number._uint64 = integer;
+                        }
+                        return true;
+                    }
+
+                    if (integer <= static_cast <uint64_t> (std::numeric_limits <int64_t>::max ()) + 1)
+                    {
+                        number._type = NumberInt64;
+                        number._int64 = static_cast <int64_t> (0 - integer);
+                        return true;
+                    }
+                }
+            }
+            // out of range integers are converted as a double.
+            // fall through
+            case details::Token::Number:
+                number._type = NumberDouble;
+                if (likely (details::strtodFast (neg, significand, exponent, truncated, number._double)))
+                {
+                    return true;
+                }
+                if (details::strtodSlow (beg, number._double) != view.data ())
+                {
+                    view = beg;
+                    return false;
+                }
+                return true;
+            case details::Token::Infinity:
+                number._type = NumberDouble;
+                number._double = neg ? -std::numeric_limits <double>::infinity () : std::numeric_limits <double>::infinity ();
+                return true;
+            case details::Token::NaN:
+                number._type = NumberDouble;
+                number._double = neg ? -std::numeric_limits <double>::quiet_NaN () : std::numeric_limits <double>::quiet_NaN ();
+                return true;
+            default:
+                view = beg;
+                return false;
+        }
+    }
+
+    /**
+     * @brief parse a number, keeping integers as integers.
+     * @param first string first position.
+     * @param last string last position.
+     * @param number parsed number.
+     * @return end position on success, nullptr on failure.
+     */
+    inline const char* parseNumber (const char* first, const char* last, Number& number)
+    {
+        View view (first, last);
+        return parseNumber (view, number) ? view.data () : nullptr;
+    }
+}
+
+#endif
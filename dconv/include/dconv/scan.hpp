@@ -0,0 +1,367 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_SCAN_HPP__
+#define __DCONV_SCAN_HPP__
+
+// dconv.
+#include <dconv/atod.hpp>
+
+// C++.
+#include <algorithm>
+#include <limits>
+#include <string>
+
+// C.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dconv
+{
+    /**
+     * @brief number classification.
+     */
+    enum NumberKind
+    {
+        NumberInvalid,      /**< grammar error. */
+        NumberInteger,      /**< digits only. */
+        NumberDecimal,      /**< digits with a fractional part. */
+        NumberExponent,     /**< digits with an exponent. */
+        NumberSpecial,      /**< infinity or not a number. */
+    };
+
+    /**
+     * @brief scanned number.
+     */
+    struct NumberToken
+    {
+        const char* _first;     /**< first position. */
+        const char* _last;      /**< position after the number. */
+        NumberKind _kind;       /**< number classification. */
+        size_t _digits;         /**< number of digits of the integral and fractional parts. */
+    };
+
+    /**
+     * @brief number already split by an external tokenizer.
+     *
+     * the spans must hold digits only, and the integral part at least one digit.
+     */
+    struct NumberSpans
+    {
+        const char* _integer;       /**< first integral digit. */
+        size_t _integerLength;      /**< number of integral digits. */
+        const char* _fraction;      /**< first fractional digit. */
+        size_t _fractionLength;     /**< number of fractional digits (0 if none). */
+        int64_t _exponent;          /**< exponent value (0 if none). */
+        bool _negative;             /**< sign. */
+    };
+
+    namespace details
+    {
+        /**
+         * @brief accumulate a span of valid digits.
+         * @param pos first digit.
+         * @param length number of digits.
+         * @param significand accumulated significand.
+         * @param digits number of significant digits accumulated.
+         * @param truncated set if a non zero digit is dropped.
+         * @return number of dropped digits.
+         */
+        inline size_t accumulateDigits (const char* pos, size_t length, uint64_t& significand, size_t& digits, bool& truncated) noexcept
+        {
+            if (digits == 0)
+            {
+                while (length && (*pos == '0'))
+                {
+                    ++pos;
+                    --length;
+                }
+            }
+
+            const size_t kept = std::min <size_t> (length, 19 - digits);
+            size_t i = 0;
+
+            for (; (i + 8) <= kept; i += 8)
+            {
+                significand = (100000000 * significand) + parseEightDigits (loadChunk (pos + i));
+            }
+
+            for (; i < kept; ++i)
+            {
+                significand = (10 * significand) + (pos[i] - '0');
+            }
+
+            digits += kept;
+
+            for (; i < length; ++i)
+            {
+                truncated |= (pos[i] != '0');
+            }
+
+            return length - kept;
+        }
+
+        /**
+         * @brief skip a run of digits.
+         * @param pos first position.
+         * @param end last position.
+         * @return position of the first character that is not a digit.
+         */
+        inline const char* skipDigits (const char* pos, const char* end) noexcept
+        {
+        #if defined(__SSE2__)
+            while (end - pos >= 16)
+            {
+                const __m128i c = _mm_loadu_si128 (reinterpret_cast <const __m128i*> (pos));
+                const __m128i digits = _mm_and_si128 (_mm_cmpgt_epi8 (c, _mm_set1_epi8 ('0' - 1)), _mm_cmplt_epi8 (c, _mm_set1_epi8 ('9' + 1)));
+                const int mask = ~_mm_movemask_epi8 (digits) & 0xFFFF;
+
+                if (mask)
+                {
+                    return pos + __builtin_ctz (mask);
+                }
+
+                pos += 16;
+            }
+        #endif
+
+            while ((pos < end) && isDigit (*pos))
+            {
+                ++pos;
+            }
+
+            return pos;
+        }
+    }
+
+    /**
+     * @brief scan a number without converting it.
+     * @param view view positioned at the number, moved past it on success.
+     * @return scanned number, of kind NumberInvalid on grammar error (view is left untouched).
+     */
+    inline NumberToken scan (View& view) noexcept
+    {
+        const char* first = view.data ();
+        const char* end = first + view.size ();
+        const char* pos = first;
+        NumberToken token = {first, first, NumberInvalid, 0};
+
+        pos += (pos < end) && (*pos == '-');
+
+        if ((pos < end) && details::isDigit (*pos))
+        {
+            const char* beg = pos;
+
+            if (*pos == '0')
+            {
+                ++pos;
+            }
+            else
+            {
+                pos = details::skipDigits (pos + 1, end);
+            }
+
+            if (unlikely ((pos < end) && details::isDigit (*pos)))
+            {
+                return token;
+            }
+
+            token._kind = NumberInteger;
+            token._digits = pos - beg;
+
+            if ((pos < end) && (*pos == '.'))
+            {
+                beg = ++pos;
+                pos = details::skipDigits (pos, end);
+
+                if (unlikely (pos == beg))
+                {
+                    return {first, first, NumberInvalid, 0};
+                }
+
+                token._kind = NumberDecimal;
+                token._digits += pos - beg;
+            }
+
+            if ((pos < end) && ((*pos | 32) == 'e'))
+            {
+                ++pos;
+                pos += (pos < end) && details::isSign (*pos);
+                beg = pos;
+                pos = details::skipDigits (pos, end);
+
+                if (unlikely (pos == beg))
+                {
+                    return {first, first, NumberInvalid, 0};
+                }
+
+                token._kind = NumberExponent;
+            }
+        }
+        else
+        {
+            View special (pos, end);
+
+            if (special.getIfNoCase ('i') && special.getIfNoCase ('n') && special.getIfNoCase ('f'))
+            {
+                if (special.getIfNoCase ('i') && !(special.getIfNoCase ('n') && special.getIfNoCase ('i') &&
+                                                   special.getIfNoCase ('t') && special.getIfNoCase ('y')))
+                {
+                    return token;
+                }
+            }
+            else if (!(special.getIfNoCase ('n') && special.getIfNoCase ('a') && special.getIfNoCase ('n')))
+            {
+                return token;
+            }
+
+            token._kind = NumberSpecial;
+            pos = special.data ();
+        }
+
+        token._last = pos;
+        view = View (pos, end);
+
+        return token;
+    }
+
+    /**
+     * @brief convert a number already split by an external tokenizer.
+     * @param spans number spans.
+     * @param value converted value.
+     * @return true on success.
+     */
+    inline bool atod (const NumberSpans& spans, double& value)
+    {
+        uint64_t significand = 0;
+        size_t digits = 0;
+        bool truncated = false;
+
+        // dropped integral digits raise the exponent, kept fractional ones lower it.
+        int64_t exponent = spans._exponent;
+        exponent += static_cast <int64_t> (details::accumulateDigits (spans._integer, spans._integerLength, significand, digits, truncated));
+        exponent -= static_cast <int64_t> (spans._fractionLength - details::accumulateDigits (spans._fraction, spans._fractionLength, significand, digits, truncated));
+
+        if (likely (details::strtodFast (spans._negative, significand, exponent, truncated, value)))
+        {
+            return true;
+        }
+
+        // the number text is rebuilt for the exact conversion.
+        std::string str (spans._negative ? "-" : "");
+        str.append (spans._integer, spans._integerLength);
+        if (spans._fractionLength)
+        {
+            str += '.';
+            str.append (spans._fraction, spans._fractionLength);
+        }
+        str += 'e';
+        str += std::to_string (spans._exponent);
+
+        return details::strtodSlow (View (str.c_str (), str.size ()), value) == (str.c_str () + str.size ());
+    }
+
+    /**
+     * @brief scanned number converted on first access.
+     */
+    class LazyNumber
+    {
+    public:
+        /**
+         * @brief create an invalid number.
+         */
+        LazyNumber () noexcept = default;
+
+        /**
+         * @brief create a number from a scanned token.
+         * @param token scanned number.
+         */
+        explicit LazyNumber (const NumberToken& token) noexcept
+        : _token (token)
+        {
+        }
+
+        /**
+         * @brief scan a number.
+         * @param view view positioned at the number, moved past it on success.
+         */
+        explicit LazyNumber (View& view) noexcept
+        : _token (scan (view))
+        {
+        }
+
+        /**
+         * @brief get the scanned number.
+         * @return scanned number.
+         */
+        const NumberToken& token () const noexcept
+        {
+            return _token;
+        }
+
+        /**
+         * @brief check if the number is valid.
+         * @return true if the number is valid.
+         */
+        bool valid () const noexcept
+        {
+            return _token._kind != NumberInvalid;
+        }
+
+        /**
+         * @brief get the number value, converted on the first call.
+         * @return number value, NaN if the number is invalid.
+         */
+        double value () const
+        {
+            if (unlikely (!_converted))
+            {
+                if (!valid () || (atod (_token._first, _token._last, _value) == nullptr))
+                {
+                    _value = std::numeric_limits <double>::quiet_NaN ();
+                }
+                _converted = true;
+            }
+
+            return _value;
+        }
+
+    private:
+        /// scanned number.
+        NumberToken _token = {nullptr, nullptr, NumberInvalid, 0};
+
+        /// cached value.
+        mutable double _value = 0.0;
+
+        /// true once converted.
+        mutable bool _converted = false;
+    };
+}
+
+#endif
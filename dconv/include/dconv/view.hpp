@@ -27,6 +27,7 @@
 
 // C++.
 #include <string>
+#include <type_traits>
 
 // C.
 #include <cstring>
@@ -38,9 +39,10 @@
 namespace dconv
 {
     /**
-     * @brief char array view.
+     * @brief character array view.
      */
-    class View
+    template <typename CharT>
+    class BasicView
     {
     public:
         /**
@@ -48,7 +50,7 @@ namespace dconv
          * @param s pointer to a character array.
          * @param count number of characters in the sequence.
          */
-        explicit constexpr View (const char * s, size_t count)
+        explicit constexpr BasicView (const CharT * s, size_t count)
         : _pos (s)
         , _end (s ? s + count : s)
         {
@@ -59,7 +61,7 @@ namespace dconv
          * @param first pointer to the first character of the sequence.
          * @param last pointer to the last character of the sequence.
          */
-        constexpr View (const char * first, const char * last)
+        constexpr BasicView (const CharT * first, const CharT * last)
         : _pos (first)
         , _end (last)
         {
@@ -69,9 +71,9 @@ namespace dconv
          * @brief default constructor.
          * @param s pointer to a character array.
          */
-        explicit View (const char * s)
+        explicit BasicView (const CharT * s)
         : _pos (s)
-        , _end (s ? s + std::char_traits <char>::length (s) : s)
+        , _end (s ? s + std::char_traits <CharT>::length (s) : s)
         {
         }
 
@@ -79,32 +81,32 @@ namespace dconv
          * @brief copy constructor.
          * @param other object to copy.
          */
-        View (const View& other) noexcept = default;
+        BasicView (const BasicView& other) noexcept = default;
 
         /**
          * @brief copy assignment.
          * @param other object to copy.
          * @return a reference of the current object.
          */
-        View& operator= (const View& other) noexcept = default;
+        BasicView& operator= (const BasicView& other) noexcept = default;
 
         /**
          * @brief move constructor.
          * @param other object to move.
          */
-        View (View&& other) noexcept = default;
+        BasicView (BasicView&& other) noexcept = default;
 
         /**
          * @brief move assignment.
          * @param other object to move.
          * @return a reference of the current object.
          */
-        View& operator=(View&& other) noexcept = default;
+        BasicView& operator=(BasicView&& other) noexcept = default;
 
         /**
          * @brief destroy instance.
          */
-        ~View () = default;
+        ~BasicView () = default;
 
         /**
          * @brief get character without extracting it.
@@ -114,7 +116,7 @@ namespace dconv
         {
             if (likely (_pos < _end))
             {
-                return static_cast <unsigned char> (*_pos);
+                return code (*_pos);
             }
             return std::char_traits <char>::eof ();
         }
@@ -127,7 +129,7 @@ namespace dconv
         {
             if (likely (_pos < _end))
             {
-                return static_cast <unsigned char> (*_pos++);
+                return code (*_pos++);
             }
             return std::char_traits <char>::eof ();
         }
@@ -139,7 +141,7 @@ namespace dconv
          */
         inline bool getIf (char expected) noexcept
         {
-            if (likely (_pos < _end) && (*_pos == expected))
+            if (likely (_pos < _end) && (*_pos == static_cast <CharT> (expected)))
             {
                 ++_pos;
                 return true;
@@ -156,7 +158,7 @@ namespace dconv
         {
             if (likely (_pos < _end))
             {
-                const char c = *_pos;
+                const int c = code (*_pos);
                 if ((c | 32) == (expected | 32))
                 {
                     ++_pos;
@@ -170,7 +172,7 @@ namespace dconv
          * @brief returns a pointer to the first character of a view.
          * @return a pointer to the first character of a view.
          */
-        inline const char * data () const noexcept
+        inline const CharT * data () const noexcept
         {
             return _pos;
         }
@@ -185,12 +187,44 @@ namespace dconv
         }
 
     private:
+        /**
+         * @brief get the code of a character.
+         * @param c character.
+         * @return character code, code units outside of the unicode range are mapped to 0x110000.
+         */
+        static constexpr int code (CharT c) noexcept
+        {
+            using Unsigned = typename std::make_unsigned <CharT>::type;
+            return (static_cast <Unsigned> (c) <= 0x10FFFF) ? static_cast <int> (static_cast <Unsigned> (c)) : 0x110000;
+        }
+
         /// current position.
-        const char * _pos = nullptr;
+        const CharT * _pos = nullptr;
 
         /// end position.
-        const char * _end = nullptr;
+        const CharT * _end = nullptr;
+    };
+
+    /**
+     * @brief char array view.
+     */
+    using View = BasicView <char>;
+
+    /**
+     * @brief check if a type is a supported character type.
+     */
+    template <typename CharT>
+    struct IsCharType : std::integral_constant <bool,
+        std::is_same <CharT, char>::value || std::is_same <CharT, wchar_t>::value ||
+        std::is_same <CharT, char16_t>::value || std::is_same <CharT, char32_t>::value>
+    {
     };
+
+    /**
+     * @brief enable a wide character overload.
+     */
+    template <typename CharT>
+    using EnableIfWideChar = typename std::enable_if <IsCharType <CharT>::value && !std::is_same <CharT, char>::value>::type;
 }
 
 #endif
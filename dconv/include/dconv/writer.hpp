@@ -0,0 +1,481 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __DCONV_WRITER_HPP__
+#define __DCONV_WRITER_HPP__
+
+// dconv.
+#include <dconv/fixed.hpp>
+#include <dconv/dtoa.hpp>
+
+// C++.
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+// C.
+#include <unistd.h>
+#include <cstdlib>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+
+namespace dconv
+{
+    /**
+     * @brief sink appending to a string (any allocator).
+     *
+     * the string is grown ahead of the writes and shrunk to the written length on release,
+     * so that values are written in place.
+     */
+    template <typename String = std::string>
+    class StringSink
+    {
+    public:
+        /**
+         * @brief create a sink appending to a string.
+         * @param str string to append to.
+         */
+        explicit StringSink (String& str) noexcept
+        : _str (str)
+        {
+        }
+
+        /**
+         * @brief get a writable range.
+         * @param pos current write position (nullptr if none).
+         * @param need number of characters needed.
+         * @param end end of the writable range.
+         * @return write position, nullptr on failure.
+         */
+        char* acquire (char* pos, size_t need, char*& end)
+        {
+            const size_t used = pos ? pos - &_str[0] : _str.size ();
+
+            if (_str.size () < used + need)
+            {
+                _str.resize (std::max (used + need, 2 * _str.size ()));
+            }
+
+            end = &_str[0] + _str.size ();
+
+            return &_str[0] + used;
+        }
+
+        /**
+         * @brief release the writable range.
+         * @param pos end of the written characters.
+         * @return true on success.
+         */
+        bool release (char* pos)
+        {
+            _str.resize (pos - &_str[0]);
+            return true;
+        }
+
+    private:
+        /// string to append to.
+        String& _str;
+    };
+
+    /**
+     * @brief sink writing to a fixed size array.
+     */
+    class ArraySink
+    {
+    public:
+        /**
+         * @brief create a sink writing to an array.
+         * @param buffer array to write to.
+         * @param size array size.
+         */
+        ArraySink (char* buffer, size_t size) noexcept
+        : _beg (buffer)
+        , _pos (buffer)
+        , _end (buffer + size)
+        {
+        }
+
+        /**
+         * @brief create a sink writing to an array.
+         * @param buffer array to write to.
+         */
+        template <size_t N>
+        explicit ArraySink (char (&buffer)[N]) noexcept
+        : ArraySink (buffer, N)
+        {
+        }
+
+        /**
+         * @brief get a writable range.
+         * @param pos current write position (nullptr if none).
+         * @param need number of characters needed.
+         * @param end end of the writable range.
+         * @return write position, nullptr if the array is full.
+         */
+        char* acquire (char* pos, size_t need, char*& end) noexcept
+        {
+            pos = pos ? pos : _pos;
+
+            if (static_cast <size_t> (_end - pos) < need)
+            {
+                _pos = pos;
+                return nullptr;
+            }
+
+            end = _end;
+
+            return pos;
+        }
+
+        /**
+         * @brief release the writable range.
+         * @param pos end of the written characters.
+         * @return true on success.
+         */
+        bool release (char* pos) noexcept
+        {
+            _pos = pos;
+            return true;
+        }
+
+        /**
+         * @brief get the written characters.
+         * @return written characters.
+         */
+        const char* data () const noexcept
+        {
+            return _beg;
+        }
+
+        /**
+         * @brief get the number of written characters.
+         * @return number of written characters.
+         */
+        size_t size () const noexcept
+        {
+            return _pos - _beg;
+        }
+
+    private:
+        /// array first position.
+        char* _beg = nullptr;
+
+        /// released position.
+        char* _pos = nullptr;
+
+        /// array end position.
+        char* _end = nullptr;
+    };
+
+    /**
+     * @brief sink writing to a file descriptor in large blocks.
+     */
+    class FdSink
+    {
+    public:
+        /**
+         * @brief create a sink writing to a file descriptor.
+         * @param fd file descriptor to write to.
+         * @param size block size.
+         */
+        explicit FdSink (int fd, size_t size = 64 * 1024)
+        : _fd (fd)
+        , _size (size)
+        , _buffer (new char [size])
+        {
+        }
+
+        /**
+         * @brief get a writable range, flushing the pending block if needed.
+         * @param pos current write position (nullptr if none).
+         * @param need number of characters needed.
+         * @param end end of the writable range.
+         * @return write position, nullptr on failure.
+         */
+        char* acquire (char* pos, size_t need, char*& end)
+        {
+            if ((need > _size) || (pos && !flush (pos)))
+            {
+                return nullptr;
+            }
+
+            end = _buffer.get () + _size;
+
+            return _buffer.get ();
+        }
+
+        /**
+         * @brief release the writable range, flushing the pending block.
+         * @param pos end of the written characters.
+         * @return true on success.
+         */
+        bool release (char* pos)
+        {
+            return flush (pos);
+        }
+
+    private:
+        /**
+         * @brief write the pending block.
+         * @param pos end of the pending block.
+         * @return true on success.
+         */
+        bool flush (const char* pos)
+        {
+            const char* data = _buffer.get ();
+
+            while (data < pos)
+            {
+                ssize_t written = ::write (_fd, data, pos - data);
+
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    return false;
+                }
+
+                data += written;
+            }
+
+            return true;
+        }
+
+        /// file descriptor.
+        int _fd = -1;
+
+        /// block size.
+        size_t _size = 0;
+
+        /// block buffer.
+        std::unique_ptr <char []> _buffer;
+    };
+
+    /**
+     * @brief buffered number writer.
+     *
+     * the remaining capacity is checked once per value against its maximum length,
+     * then the value is written in place in the sink.
+     *
+     * Sink must provide char* acquire (char* pos, size_t need, char*& end) and bool release (char* pos).
+     */
+    template <typename Sink>
+    class Writer
+    {
+    public:
+        /// maximum length of a double string representation.
+        static constexpr size_t maxDoubleLength = 25;
+
+        /**
+         * @brief create a writer.
+         * @param sink sink to write to.
+         */
+        explicit Writer (Sink& sink) noexcept
+        : _sink (sink)
+        {
+        }
+
+        /**
+         * @brief copy constructor.
+         * @param other object to copy.
+         */
+        Writer (const Writer& other) = delete;
+
+        /**
+         * @brief copy assignment.
+         * @param other object to copy.
+         * @return a reference of the current object.
+         */
+        Writer& operator= (const Writer& other) = delete;
+
+        /**
+         * @brief destroy the writer, flushing the pending characters.
+         */
+        ~Writer ()
+        {
+            flush ();
+        }
+
+        /**
+         * @brief write a double.
+         * @param value value to write.
+         * @return a reference of the current object.
+         */
+        Writer& write (double value)
+        {
+            if (likely (reserve (maxDoubleLength)))
+            {
+                _pos = dtoa (_pos, value);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief write a fixed point value.
+         * @param value scaled value to write.
+         * @param scale number of decimal digits of the value.
+         * @param flags formatting flags.
+         * @return a reference of the current object.
+         */
+        Writer& write (int64_t value, int scale, int flags = FixedDefault)
+        {
+            if (likely (reserve (23 + static_cast <size_t> (std::abs (scale)))))
+            {
+                _pos = fixedtoa (_pos, value, scale, flags);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief write an integer.
+         * @param value value to write.
+         * @return a reference of the current object.
+         */
+        template <typename Integer, typename = std::enable_if_t <std::is_integral <Integer>::value>>
+        Writer& write (Integer value)
+        {
+            static_assert (!std::is_same <Integer, char>::value && !std::is_same <Integer, bool>::value,
+                           "characters are written with put ()");
+
+            if (likely (reserve (21)))
+            {
+                const bool negative = std::is_signed <Integer>::value && (static_cast <int64_t> (value) < 0);
+                *_pos = '-';
+                _pos += negative;
+                _pos += details::writeDigits (_pos, negative ? 0 - static_cast <uint64_t> (value) : static_cast <uint64_t> (value));
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief write a character.
+         * @param c character to write.
+         * @return a reference of the current object.
+         */
+        Writer& put (char c)
+        {
+            if (likely (reserve (1)))
+            {
+                *_pos++ = c;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief write characters.
+         * @param str characters to write.
+         * @param length number of characters to write.
+         * @return a reference of the current object.
+         */
+        Writer& write (const char* str, size_t length)
+        {
+            while (length && reserve (1))
+            {
+                size_t count = std::min (length, static_cast <size_t> (_end - _pos));
+                memcpy (_pos, str, count);
+                _pos += count;
+                str += count;
+                length -= count;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief release the pending characters to the sink.
+         * @return true if no error occurred since the writer creation.
+         */
+        bool flush ()
+        {
+            if (_pos)
+            {
+                _good = _sink.release (_pos) && _good;
+                _pos = _end = nullptr;
+            }
+
+            return _good;
+        }
+
+        /**
+         * @brief check whether an error occurred.
+         * @return true if no error occurred since the writer creation.
+         */
+        bool good () const noexcept
+        {
+            return _good;
+        }
+
+    private:
+        /**
+         * @brief make sure that characters can be written.
+         * @param need number of characters needed.
+         * @return true if at least need characters can be written.
+         */
+        bool reserve (size_t need)
+        {
+            if (likely (static_cast <size_t> (_end - _pos) >= need))
+            {
+                return true;
+            }
+
+            char* pos = _good ? _sink.acquire (_pos, need, _end) : nullptr;
+
+            if (unlikely (pos == nullptr))
+            {
+                _good = false;
+                return false;
+            }
+
+            _pos = pos;
+
+            return true;
+        }
+
+        /// sink.
+        Sink& _sink;
+
+        /// write position.
+        char* _pos = nullptr;
+
+        /// writable range end.
+        char* _end = nullptr;
+
+        /// error state.
+        bool _good = true;
+    };
+
+    template <typename Sink>
+    constexpr size_t Writer <Sink>::maxDoubleLength;
+}
+
+#endif
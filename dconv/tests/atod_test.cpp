@@ -303,6 +303,39 @@ TEST (atod, atod)
     ASSERT_NE (dconv::atod ("5708990770823839207320493820740630171355185152001e-3", value), nullptr);
     EXPECT_EQ (value, 5708990770823839524233143877797980545530986496.0);
 
+    ASSERT_NE (dconv::atod ("5.027850982437962e43", value), nullptr);
+    EXPECT_EQ (value, 5.027850982437962e43);
+
+    ASSERT_NE (dconv::atod ("-7.838100213585356e51", value), nullptr);
+    EXPECT_EQ (value, -7.838100213585356e51);
+
+    ASSERT_NE (dconv::atod ("1.000000000000000000000000", value), nullptr);
+    EXPECT_EQ (value, 1.0);
+
+    ASSERT_NE (dconv::atod ("0.30000000000000000000001", value), nullptr);
+    EXPECT_EQ (value, 0.3);
+
+    ASSERT_NE (dconv::atod ("0.00000000002306356146381", value), nullptr);
+    EXPECT_EQ (value, 2.306356146381e-11);
+
+    ASSERT_NE (dconv::atod ("7014954848773926.5", value), nullptr);
+    EXPECT_EQ (value, 7014954848773926.0);
+
+    ASSERT_NE (dconv::atod ("7014954848773926.50000000000000000001", value), nullptr);
+    EXPECT_EQ (value, 7014954848773927.0);
+
+    ASSERT_NE (dconv::atod ("-24456552210660266.0", value), nullptr);
+    EXPECT_EQ (value, -24456552210660264.0);
+
+    ASSERT_NE (dconv::atod ("-24456552210660266.00000000000000000001", value), nullptr);
+    EXPECT_EQ (value, -24456552210660268.0);
+
+    ASSERT_NE (dconv::atod ("123456789012345678901234567890", value), nullptr);
+    EXPECT_EQ (value, 123456789012345678901234567890.0);
+
+    ASSERT_NE (dconv::atod ("3.14159265358979323846264338327950288", value), nullptr);
+    EXPECT_EQ (value, 3.14159265358979323846264338327950288);
+
     ASSERT_NE (dconv::atod ("1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
                             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
                             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
@@ -320,6 +353,113 @@ TEST (atod, atod)
     EXPECT_EQ (value, 2.2250738585072014e-308);
 }
 
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+/**
+ * @brief long double atod test.
+ */
+TEST (atod, atodLongDouble)
+{
+    long double value = 0.0L;
+
+    EXPECT_EQ (dconv::atod ("003", value), nullptr);
+
+    EXPECT_EQ (dconv::atod ("1.e+10", value), nullptr);
+
+    ASSERT_NE (dconv::atod ("-inf", value), nullptr);
+    EXPECT_TRUE (std::signbit (value) && std::isinf (value));
+
+    ASSERT_NE (dconv::atod ("-nan", value), nullptr);
+    EXPECT_TRUE (std::signbit (value) && std::isnan (value));
+
+    ASSERT_NE (dconv::atod ("-0.0", value), nullptr);
+    EXPECT_TRUE (std::signbit (value) && (value == 0.0L));
+
+    ASSERT_NE (dconv::atod ("0.1", value), nullptr);
+    EXPECT_EQ (value, 0.1L);
+
+    ASSERT_NE (dconv::atod ("0.5", value), nullptr);
+    EXPECT_EQ (value, 0.5L);
+
+    ASSERT_NE (dconv::atod ("-2.5", value), nullptr);
+    EXPECT_EQ (value, -2.5L);
+
+    ASSERT_NE (dconv::atod ("3.1415926535897932385", value), nullptr);
+    EXPECT_EQ (value, 3.1415926535897932385L);
+
+    ASSERT_NE (dconv::atod ("123456789012345678901234567890", value), nullptr);
+    EXPECT_EQ (value, 123456789012345678901234567890.0L);
+
+    ASSERT_NE (dconv::atod ("1e4000", value), nullptr);
+    EXPECT_EQ (value, 1e4000L);
+
+    ASSERT_NE (dconv::atod ("1e-4000", value), nullptr);
+    EXPECT_EQ (value, 1e-4000L);
+
+    ASSERT_NE (dconv::atod ("1e5000", value), nullptr);
+    EXPECT_TRUE (std::isinf (value));
+
+    ASSERT_NE (dconv::atod ("1e-5000", value), nullptr);
+    EXPECT_EQ (value, 0.0L);
+
+    ASSERT_NE (dconv::atod ("1.189731495357231765e4932", value), nullptr);
+    EXPECT_EQ (value, LDBL_MAX);
+
+    ASSERT_NE (dconv::atod ("3.3621031431120935063e-4932", value), nullptr);
+    EXPECT_EQ (value, LDBL_MIN);
+}
+#endif
+
+#if defined(DCONV_HAS_FLOAT128)
+/**
+ * @brief __float128 atod test.
+ */
+TEST (atod, atodFloat128)
+{
+    using Format = dconv::details::Wide <__float128>;
+    __float128 value = 0;
+
+    EXPECT_EQ (dconv::atod ("003", value), nullptr);
+
+    EXPECT_EQ (dconv::atod ("1.e+10", value), nullptr);
+
+    ASSERT_NE (dconv::atod ("-inf", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (true, Format::_maxExponent, 0)));
+
+    ASSERT_NE (dconv::atod ("-0.0", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (true, 0, 0)));
+
+    ASSERT_NE (dconv::atod ("0.5", value), nullptr);
+    EXPECT_TRUE (value == static_cast <__float128> (0.5));
+
+    ASSERT_NE (dconv::atod ("-2.5", value), nullptr);
+    EXPECT_TRUE (value == static_cast <__float128> (-2.5));
+
+    ASSERT_NE (dconv::atod ("0.3333333333333333333333333333333333", value), nullptr);
+    EXPECT_TRUE (value == static_cast <__float128> (1) / 3);
+
+    ASSERT_NE (dconv::atod ("0.1000000000000000055511151231257827", value), nullptr);
+    EXPECT_TRUE (value == static_cast <__float128> (0.1));
+
+    ASSERT_NE (dconv::atod ("1.189731495357231765085759326628007e4932", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (false, Format::_maxExponent - 1, ~static_cast <__uint128_t> (0))));
+
+    ASSERT_NE (dconv::atod ("1.18973149535723176508575932662800702e4932", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (false, Format::_maxExponent - 1, ~static_cast <__uint128_t> (0))));
+
+    ASSERT_NE (dconv::atod ("6e-4966", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (false, 0, 1)));
+
+    ASSERT_NE (dconv::atod ("3e-4966", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (false, 0, 0)));
+
+    ASSERT_NE (dconv::atod ("3.3621031431120935062626778173217526e-4932", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (false, 1, Format::_hiddenBit)));
+
+    ASSERT_NE (dconv::atod ("1.2e5000", value), nullptr);
+    EXPECT_EQ (Format::toBits (value), Format::toBits (Format::fromBits (false, Format::_maxExponent, 0)));
+}
+#endif
+
 /**
  * @brief main function.
  */
@@ -0,0 +1,147 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/batch.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief join the scalar conversions of values.
+ * @param values values to convert.
+ * @param separator separator.
+ * @return joined string representations.
+ */
+static std::string join (const std::vector <double>& values, char separator)
+{
+    std::string result;
+    char buffer [32];
+
+    for (size_t i = 0; i < values.size (); ++i)
+    {
+        if (i)
+        {
+            result += separator;
+        }
+        result.append (buffer, dconv::dtoa (buffer, values[i]) - buffer);
+    }
+
+    return result;
+}
+
+/**
+ * @brief batch dtoa test.
+ */
+TEST (batch, dtoa)
+{
+    std::vector <double> values;
+    std::vector <char> buffer (26 * 64);
+
+    char* end = dconv::dtoa (buffer.data (), values.data (), values.data ());
+    EXPECT_EQ (end, buffer.data ());
+
+    values = {0.0, -0.0, 0.1, -1.5, 123.0, 1e21, 1.7976931348623157e308, 2.2250738585072014e-308, 4.9406564584124654e-324,
+        -std::numeric_limits <double>::infinity (), 1.0 / 3.0};
+
+    end = dconv::dtoa (buffer.data (), values.data (), values.data () + values.size ());
+    EXPECT_EQ (std::string (buffer.data (), end - buffer.data ()), join (values, ','));
+
+    end = dconv::dtoa (buffer.data (), values.data (), values.data () + 2, ';');
+    EXPECT_EQ (std::string (buffer.data (), end - buffer.data ()), "0.0;-0.0");
+
+    std::mt19937_64 rng;
+
+    for (size_t count = 1; count <= 64; ++count)
+    {
+        values.clear ();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t bits = rng ();
+            double value;
+            memcpy (&value, &bits, sizeof (double));
+            values.push_back (value);
+        }
+
+        end = dconv::dtoa (buffer.data (), values.data (), values.data () + values.size ());
+        EXPECT_EQ (std::string (buffer.data (), end - buffer.data ()), join (values, ','));
+    }
+}
+
+#if defined(DCONV_HAS_BATCH_SIMD)
+/**
+ * @brief batch dtoa kernels test.
+ */
+TEST (batch, kernels)
+{
+    std::vector <dconv::details::BatchFunction> kernels;
+
+    __builtin_cpu_init ();
+
+    if (__builtin_cpu_supports ("avx2"))
+    {
+        kernels.push_back (dconv::details::dtoaBatchAvx2);
+    }
+
+    if (__builtin_cpu_supports ("avx512f"))
+    {
+        kernels.push_back (dconv::details::dtoaBatchAvx512);
+    }
+
+    std::mt19937_64 rng;
+    std::vector <double> values;
+
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = rng ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+        values.push_back (value);
+    }
+
+    std::vector <char> expected (26 * values.size ());
+    char* last = dconv::details::dtoaBatchScalar (expected.data (), values.data (), values.size (), ',');
+
+    for (auto kernel : kernels)
+    {
+        std::vector <char> buffer (26 * values.size ());
+        char* end = kernel (buffer.data (), values.data (), values.size (), ',');
+        ASSERT_EQ (end - buffer.data (), last - expected.data ());
+        EXPECT_EQ (memcmp (buffer.data (), expected.data (), end - buffer.data ()), 0);
+    }
+}
+#endif
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
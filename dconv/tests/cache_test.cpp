@@ -0,0 +1,136 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/cache.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * @brief DtoaCache test.
+ */
+TEST (cache, dtoa)
+{
+    std::unique_ptr <dconv::DtoaCache <>> cache (new dconv::DtoaCache <> ());
+    char buffer [25], expected [25];
+
+    char* end = cache->dtoa (buffer, 0.1);
+    EXPECT_EQ (std::string (buffer, end), "0.1");
+    EXPECT_EQ (cache->hits (), 0);
+    EXPECT_EQ (cache->misses (), 1);
+
+    end = cache->dtoa (buffer, 0.1);
+    EXPECT_EQ (std::string (buffer, end), "0.1");
+    EXPECT_EQ (cache->hits (), 1);
+    EXPECT_EQ (cache->misses (), 1);
+
+    end = cache->dtoa (buffer, -0.0);
+    EXPECT_EQ (std::string (buffer, end), "-0.0");
+    end = cache->dtoa (buffer, 0.0);
+    EXPECT_EQ (std::string (buffer, end), "0.0");
+
+    cache->clear ();
+    EXPECT_EQ (cache->hits (), 0);
+    EXPECT_EQ (cache->misses (), 0);
+
+    std::mt19937_64 gen (42);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        // low cardinality values on a tick grid.
+        double value = static_cast <double> (gen () % 200) * 0.05;
+        end = cache->dtoa (buffer, value);
+        char* last = dconv::dtoa (expected, value);
+        ASSERT_EQ (std::string (buffer, end), std::string (expected, last)) << value;
+    }
+
+    EXPECT_EQ (cache->hits () + cache->misses (), 100000);
+    EXPECT_GT (cache->hits (), 90000);
+}
+
+/**
+ * @brief AtodCache test.
+ */
+TEST (cache, atod)
+{
+    std::unique_ptr <dconv::AtodCache <>> cache (new dconv::AtodCache <> ());
+    double value = 0.0;
+
+    EXPECT_EQ (cache->atod ("", value), nullptr);
+    EXPECT_EQ (cache->atod ("+1", value), nullptr);
+    EXPECT_EQ (cache->atod ("1.5e+", value), nullptr);
+    EXPECT_EQ (cache->atod ("1.5e+", value), nullptr);
+    EXPECT_EQ (cache->hits (), 0);
+
+    std::string str ("1.5,1.5,1.25,12345678901234567890123456789");
+    const char* first = str.data ();
+    const char* last = str.data () + str.size ();
+    cache->clear ();
+
+    first = cache->atod (first, last, value);
+    ASSERT_EQ (first, str.data () + 3);
+    EXPECT_EQ (value, 1.5);
+    EXPECT_EQ (cache->hits (), 0);
+
+    first = cache->atod (first + 1, last, value);
+    ASSERT_EQ (first, str.data () + 7);
+    EXPECT_EQ (value, 1.5);
+    EXPECT_EQ (cache->hits (), 1);
+
+    first = cache->atod (first + 1, last, value);
+    ASSERT_EQ (first, str.data () + 12);
+    EXPECT_EQ (value, 1.25);
+    EXPECT_EQ (cache->hits (), 1);
+
+    first = cache->atod (first + 1, last, value);
+    ASSERT_EQ (first, last);
+    EXPECT_EQ (value, 12345678901234567890123456789.0);
+    EXPECT_EQ (cache->misses (), 3);
+
+    std::mt19937_64 gen (42);
+    char buffer [32];
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        double expected = static_cast <double> (gen () % 200) * 0.05;
+        char* end = dconv::dtoa (buffer, expected);
+        *end = ',';
+        ASSERT_EQ (cache->atod (buffer, end + 1, value), end);
+        ASSERT_EQ (value, expected) << std::string (buffer, end);
+    }
+
+    EXPECT_GT (cache->hits (), 90000);
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
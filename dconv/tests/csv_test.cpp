@@ -0,0 +1,168 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/csv.hpp>
+#include <dconv/dtoa.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief decode test.
+ */
+TEST (csv, decode)
+{
+    std::vector <int64_t> ts;
+    std::vector <double> x, value;
+
+    dconv::CsvDecoder decoder (5);
+    decoder.bind (0, ts).bind (1, x).skip (2).bind (4, value);
+
+    std::string csv = "1700000000,1.5,abc,2,-0.25\n1700000001,-2e3,,3,1e-7\r\n\n1700000002,0,x y,4,inf";
+    ASSERT_TRUE (decoder.decode (csv.data (), csv.data () + csv.size ()));
+    EXPECT_EQ (ts, (std::vector <int64_t> {1700000000, 1700000001, 1700000002}));
+    EXPECT_EQ (x, (std::vector <double> {1.5, -2e3, 0.0}));
+    ASSERT_EQ (value.size (), 3);
+    EXPECT_EQ (value[0], -0.25);
+    EXPECT_EQ (value[1], 1e-7);
+    EXPECT_TRUE (std::isinf (value[2]));
+
+    // appended by a second call.
+    csv = "-5;3.25\n";
+    std::vector <int64_t> a;
+    std::vector <double> b;
+    dconv::CsvDecoder semicolon (2, ';');
+    semicolon.bind (0, a).bind (1, b);
+    ASSERT_TRUE (semicolon.decode (csv.data (), csv.data () + csv.size ()));
+    ASSERT_TRUE (semicolon.decode (csv.data (), csv.data () + csv.size ()));
+    EXPECT_EQ (a, (std::vector <int64_t> {-5, -5}));
+    EXPECT_EQ (b, (std::vector <double> {3.25, 3.25}));
+}
+
+/**
+ * @brief error test.
+ */
+TEST (csv, error)
+{
+    struct Error
+    {
+        std::string csv;
+        size_t row;
+        size_t column;
+        size_t rows;
+    };
+
+    const Error errors[] = {
+        {"1,2,3\n4,x,6\n", 1, 1, 1},
+        {"1,2,3\n4,5\n", 1, 2, 1},
+        {"1,2,3\n4,5,6,7\n", 1, 3, 1},
+        {"1,2,3\n\n4,5,6\n7.5,8,9\n", 3, 0, 2},
+        {"1,2,3\n4,5,6 \n", 1, 2, 1},
+        {"1,2,3\n4,,6\n", 1, 1, 1},
+        {"9223372036854775808,2,3\n", 0, 0, 0},
+    };
+
+    for (const Error& error : errors)
+    {
+        std::vector <int64_t> first;
+        std::vector <double> second, third;
+
+        dconv::CsvDecoder decoder (3);
+        decoder.bind (0, first).bind (1, second).bind (2, third);
+
+        EXPECT_FALSE (decoder.decode (error.csv.data (), error.csv.data () + error.csv.size ())) << error.csv;
+        EXPECT_EQ (decoder.row (), error.row) << error.csv;
+        EXPECT_EQ (decoder.column (), error.column) << error.csv;
+
+        // the rows before the faulty one are kept, the faulty one is dropped.
+        EXPECT_EQ (first.size (), error.rows) << error.csv;
+        EXPECT_EQ (second.size (), error.rows) << error.csv;
+        EXPECT_EQ (third.size (), error.rows) << error.csv;
+    }
+}
+
+/**
+ * @brief random test.
+ */
+TEST (csv, random)
+{
+    std::mt19937_64 gen (42);
+    std::vector <int64_t> expectedTs;
+    std::vector <double> expectedValues[3];
+    std::string csv;
+    char buffer [32];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        expectedTs.push_back (static_cast <int64_t> (gen ()));
+        csv += std::to_string (expectedTs.back ());
+
+        for (std::vector <double>& values : expectedValues)
+        {
+            uint64_t bits = gen ();
+            double value;
+            do
+            {
+                bits = gen ();
+                memcpy (&value, &bits, sizeof (double));
+            }
+            while (!std::isfinite (value));
+
+            values.push_back (value);
+            csv += ',';
+            csv.append (buffer, dconv::dtoa (buffer, value));
+        }
+
+        csv += ',';
+        csv += std::to_string (gen () % 1000);
+        csv += '\n';
+    }
+
+    std::vector <int64_t> ts;
+    std::vector <double> values[3];
+
+    dconv::CsvDecoder decoder (5);
+    decoder.bind (0, ts).bind (1, values[0]).bind (2, values[1]).bind (3, values[2]).skip (4);
+
+    // the last line has no new line.
+    csv.pop_back ();
+    ASSERT_TRUE (decoder.decode (csv.data (), csv.data () + csv.size ())) << decoder.row () << " " << decoder.column ();
+    EXPECT_EQ (ts, expectedTs);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ (values[i], expectedValues[i]);
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,208 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/decimal.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+#include <cmath>
+
+// C.
+#include <cstring>
+
+/**
+ * @brief parse a decimal.
+ * @param str string to parse.
+ * @param significand expected significand.
+ * @param exponent expected exponent.
+ * @param negative expected sign.
+ * @param truncated expected truncation.
+ */
+static void expectDecimal (const std::string& str, uint64_t significand, int64_t exponent, bool negative, bool truncated = false)
+{
+    dconv::Decimal decimal;
+    dconv::View view (str.data (), str.size ());
+
+    ASSERT_TRUE (dconv::parseDecimal (view, decimal)) << str;
+    EXPECT_EQ (decimal._significand, significand) << str;
+    EXPECT_EQ (decimal._exponent, exponent) << str;
+    EXPECT_EQ (decimal._negative, negative) << str;
+    EXPECT_EQ (decimal._truncated, truncated) << str;
+    EXPECT_EQ (view.size (), 0) << str;
+}
+
+/**
+ * @brief parseDecimal test.
+ */
+TEST (decimal, parseDecimal)
+{
+    expectDecimal ("0", 0, 0, false);
+    expectDecimal ("-0.000", 0, 0, true);
+    expectDecimal ("1", 1, 0, false);
+    expectDecimal ("1.5", 15, -1, false);
+    expectDecimal ("1.50", 15, -1, false);
+    expectDecimal ("-123.456e7", 123456, 4, true);
+    expectDecimal ("1200", 12, 2, false);
+    expectDecimal ("6.02214076e23", 602214076, 15, false);
+    expectDecimal ("12345678901234567890", 1234567890123456789, 1, false);
+    expectDecimal ("12345678901234567891", 1234567890123456789, 1, false, true);
+    expectDecimal ("1.00000000000000000001", 1000000000000000000, -18, false, true);
+    expectDecimal ("123000000000000000000001e-5", 1230000000000000000, 0, false, true);
+
+    for (const std::string str : {"", "-", "+1", "01", "1.", ".5", "1e", "inf", "nan"})
+    {
+        dconv::Decimal decimal;
+        dconv::View view (str.data (), str.size ());
+
+        EXPECT_FALSE (dconv::parseDecimal (view, decimal)) << str;
+        EXPECT_EQ (view.data (), str.data ()) << str;
+    }
+
+    dconv::Decimal lhs, rhs;
+    std::string str = "2.50";
+    ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), lhs), nullptr);
+    str = "25e-1";
+    ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), rhs), nullptr);
+    EXPECT_TRUE (lhs == rhs);
+    str = "2.51";
+    ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), rhs), nullptr);
+    EXPECT_TRUE (lhs != rhs);
+
+    EXPECT_TRUE (dconv::isExact (lhs));
+
+    // truncated decimals compare their kept digits only.
+    str = "1.00000000000000000001";
+    ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), lhs), nullptr);
+    str = "1.00000000000000000009";
+    ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), rhs), nullptr);
+    EXPECT_FALSE (dconv::isExact (lhs));
+    EXPECT_TRUE (lhs == lhs);
+    EXPECT_TRUE (lhs == rhs);
+    str = "1";
+    ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), rhs), nullptr);
+    EXPECT_TRUE (lhs != rhs);
+}
+
+/**
+ * @brief decimalToDouble test.
+ */
+TEST (decimal, decimalToDouble)
+{
+    const std::string values[] = {
+        "0", "-0", "1", "0.1", "-1.5", "123.456", "1e22", "1e23", "6.02214076e23", "2.2250738585072011e-308",
+        "4.9406564584124654e-324", "2e-324", "1.7976931348623157e308", "1.8e308", "1e-400", "1e400",
+        "9007199254740993", "9007199254740993.00000000000000000001", "123456789012345678901234567890",
+        "1.00000000000000000001", "0.30000000000000000000001", "123000000000000000000001e-5",
+        "9007199254740992.50000000000000000001", "-4.50000000000000000000000000001e-320"
+    };
+
+    for (const std::string& str : values)
+    {
+        dconv::Decimal decimal;
+        double expected;
+
+        ASSERT_NE (dconv::parseDecimal (str.data (), str.data () + str.size (), decimal), nullptr) << str;
+        ASSERT_NE (dconv::atod (str.c_str (), expected), nullptr) << str;
+
+        const double value = dconv::decimalToDouble (decimal);
+        EXPECT_EQ (value, expected) << str;
+        EXPECT_EQ (std::signbit (value), std::signbit (expected)) << str;
+    }
+
+    // the dropped digits only count as a sticky digit, a halfway point among them can't be decided.
+    // the result lies between the conversions of the kept digits and of the next decimal.
+    const std::string halfway = "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996189898282347722858865463328355177969898199387398005390939063150356595155702263922908583924491051844359318028499365361525003193704576782492193656236698636584807570015857692699037063119282795585513329278343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378573934507363390079677619305775067401763246736009689513405355374585166611342237666786041621596804619144672918403005300575308490487653917113865916462395249126236538818796362393732804238910186723484976682350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854513962138377228261454376934125320985913276672363281251e-324";
+    dconv::Decimal decimal;
+    ASSERT_NE (dconv::parseDecimal (halfway.data (), halfway.data () + halfway.size (), decimal), nullptr);
+    ASSERT_TRUE (decimal._truncated);
+
+    const double value = dconv::decimalToDouble (decimal);
+    decimal._truncated = false;
+    const double lower = dconv::decimalToDouble (decimal);
+    ++decimal._significand;
+    const double upper = dconv::decimalToDouble (decimal);
+    EXPECT_GE (value, lower);
+    EXPECT_LE (value, upper);
+}
+
+/**
+ * @brief doubleToDecimal test.
+ */
+TEST (decimal, doubleToDecimal)
+{
+    dconv::Decimal decimal = dconv::doubleToDecimal (0.0);
+    EXPECT_EQ (decimal._significand, 0);
+    EXPECT_EQ (decimal._exponent, 0);
+    EXPECT_FALSE (decimal._negative);
+
+    decimal = dconv::doubleToDecimal (-0.0);
+    EXPECT_EQ (decimal._significand, 0);
+    EXPECT_TRUE (decimal._negative);
+
+    decimal = dconv::doubleToDecimal (0.1);
+    EXPECT_EQ (decimal._significand, 1);
+    EXPECT_EQ (decimal._exponent, -1);
+
+    decimal = dconv::doubleToDecimal (-1200.0);
+    EXPECT_EQ (decimal._significand, 12);
+    EXPECT_EQ (decimal._exponent, 2);
+    EXPECT_TRUE (decimal._negative);
+
+    std::mt19937_64 gen (42);
+    char buffer [32];
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        if (!std::isfinite (value))
+        {
+            continue;
+        }
+
+        decimal = dconv::doubleToDecimal (value);
+        ASSERT_FALSE (decimal._truncated);
+        ASSERT_NE (decimal._significand % 10, 0) << value;
+        ASSERT_EQ (dconv::decimalToDouble (decimal), value) << value;
+
+        // same decimal as the printed value once parsed.
+        char* end = dconv::dtoa (buffer, value);
+        dconv::Decimal parsed;
+        ASSERT_EQ (dconv::parseDecimal (buffer, end, parsed), end);
+        ASSERT_TRUE (parsed == decimal) << std::string (buffer, end);
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,87 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/batch.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief forced tier test.
+ */
+TEST (dispatch, forceSimdTier)
+{
+    const dconv::SimdTier best = dconv::details::detectSimdTier ();
+
+    EXPECT_EQ (dconv::simdTier (), best);
+    EXPECT_EQ (dconv::forceSimdTier (dconv::SimdScalar), dconv::SimdScalar);
+    EXPECT_EQ (dconv::simdTier (), dconv::SimdScalar);
+    EXPECT_LE (dconv::forceSimdTier (dconv::SimdAvx2), best);
+    EXPECT_EQ (dconv::forceSimdTier (dconv::SimdAvx512), best);
+    EXPECT_EQ (dconv::simdTier (), best);
+}
+
+/**
+ * @brief dispatched batch dtoa test.
+ */
+TEST (dispatch, dtoa)
+{
+    std::mt19937_64 rng;
+    std::vector <double> values;
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        uint64_t bits = rng ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+        values.push_back (value);
+    }
+
+    std::vector <char> expected (26 * values.size ());
+    char* last = dconv::details::dtoaBatchScalar (expected.data (), values.data (), values.size (), ',');
+
+    for (dconv::SimdTier tier : {dconv::SimdScalar, dconv::SimdAvx2, dconv::SimdAvx512})
+    {
+        dconv::forceSimdTier (tier);
+
+        using Dispatch = dconv::details::Dispatch <dconv::details::BatchKernel>;
+        std::vector <char> buffer (26 * values.size ());
+        char* end = dconv::dtoa (buffer.data (), values.data (), values.data () + values.size ());
+        EXPECT_EQ (Dispatch::pointer.load (), dconv::details::BatchKernel::select (dconv::simdTier ()));
+        ASSERT_EQ (end - buffer.data (), last - expected.data ());
+        EXPECT_EQ (memcmp (buffer.data (), expected.data (), end - buffer.data ()), 0);
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
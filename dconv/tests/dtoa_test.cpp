@@ -28,6 +28,13 @@
 // libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <random>
+#include <string>
+#include <utility>
+#include <cmath>
+#include <cstdlib>
+
 /**
  * @brief digitsCount test.
  */
@@ -225,6 +232,308 @@ TEST (dtoa, dtoa)
     EXPECT_STREQ (std::string (beg, end - beg).c_str (), "5.708990770823839e45");
 }
 
+/**
+ * @brief dtoaLength test.
+ */
+TEST (dtoa, dtoaLength)
+{
+    const double values[] = {
+        0.0, -0.0, 1.0, -1.0, 0.1, 0.3, 123.456, 1e21, 1e22, 123456789012345678901.0, 1e-5, 1e-6, 1e-7,
+        -1.2345e-7, 5e-324, 2.2250738585072014e-308, 1.7976931348623157e308, 9223372036854775808.0,
+        5708990770823838890407843763683279797179383808.0, 1e100, -1e-100
+    };
+
+    char beg [25] = {};
+
+    for (double value : values)
+    {
+        char* end = dconv::dtoa (beg, value);
+        EXPECT_EQ (dconv::dtoaLength (value), static_cast <size_t> (end - beg)) << value;
+    }
+
+    std::mt19937_64 gen (42);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        if (!std::isfinite (value))
+        {
+            continue;
+        }
+
+        char* end = dconv::dtoa (beg, value);
+        const dconv::PreparedDouble prepared (value);
+        ASSERT_EQ (prepared.size (), static_cast <size_t> (end - beg)) << value;
+
+        char slot [32];
+        memset (slot, '#', sizeof (slot));
+        char* last = prepared.write (slot);
+        ASSERT_EQ (last, slot + prepared.size ());
+        ASSERT_EQ (slot[prepared.size ()], '#');
+        ASSERT_EQ (std::string (slot, last), std::string (beg, end));
+    }
+}
+
+/**
+ * @brief dtoa shortest notation test.
+ */
+TEST (dtoa, dtoaShortest)
+{
+    const std::pair <double, const char*> values[] = {
+        {0.0, "0"}, {-0.0, "-0"}, {1.0, "1"}, {-1.0, "-1"}, {100.0, "100"}, {1000.0, "1e3"}, {1e6, "1e6"},
+        {1234567.0, "1234567"}, {1e21, "1e21"}, {1.5e300, "15e299"}, {0.5, "0.5"}, {0.05, "0.05"},
+        {0.005, "5e-3"}, {1e-5, "1e-5"}, {0.00123, "123e-5"}, {1.23e-7, "123e-9"}, {123.456, "123.456"},
+        {-3.14, "-3.14"}, {5e-324, "5e-324"}, {1.7976931348623157e308, "17976931348623157e292"}
+    };
+
+    char beg [32] = {};
+
+    for (const auto& value : values)
+    {
+        char* end = dconv::dtoa <dconv::NotationShortest> (beg, value.first);
+        EXPECT_EQ (std::string (beg, end), value.second) << value.first;
+    }
+
+    std::mt19937_64 gen (42);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        if (!std::isfinite (value))
+        {
+            continue;
+        }
+
+        char* end = dconv::dtoa <dconv::NotationShortest> (beg, value);
+        *end = '\0';
+        ASSERT_EQ (std::strtod (beg, nullptr), value) << beg;
+
+        char standard [32];
+        char* last = dconv::dtoa <dconv::NotationStandard> (standard, value);
+        ASSERT_EQ (std::string (standard, last), std::string (standard, dconv::dtoa (standard, value)));
+        ASSERT_LE (end - beg, last - standard) << beg << " " << std::string (standard, last);
+    }
+}
+
+/**
+ * @brief count the significant digits of a string representation.
+ * @param first first position.
+ * @param last last position.
+ * @return number of digits from the first to the last non zero one.
+ */
+static size_t significant (const char* first, const char* last)
+{
+    std::string digits;
+
+    for (const char* pos = first; (pos < last) && (*pos != 'e'); ++pos)
+    {
+        if ((*pos >= '0') && (*pos <= '9') && (!digits.empty () || (*pos != '0')))
+        {
+            digits += *pos;
+        }
+    }
+
+    return digits.find_last_not_of ('0') + 1;
+}
+
+/**
+ * @brief dtoaApprox test.
+ */
+TEST (dtoa, dtoaApprox)
+{
+    char beg [32] = {};
+    char* end;
+
+    end = dconv::dtoaApprox (beg, 3.14159265358979, 3);
+    EXPECT_EQ (std::string (beg, end), "3.14");
+
+    end = dconv::dtoaApprox (beg, 0.1 + 0.2, 6);
+    EXPECT_EQ (std::string (beg, end), "0.3");
+
+    end = dconv::dtoaApprox (beg, -123456.789, 2);
+    EXPECT_EQ (std::string (beg, end), "-120000.0");
+
+    end = dconv::dtoaApprox (beg, 9.96, 2);
+    EXPECT_EQ (std::string (beg, end), "10.0");
+
+    end = dconv::dtoaApprox (beg, 1.2345e-300, 4);
+    EXPECT_EQ (std::string (beg, end), "1.234e-300");
+
+    end = dconv::dtoaApprox (beg, 0.1, 17);
+    EXPECT_EQ (std::string (beg, end), "0.1");
+
+    end = dconv::dtoaApprox (beg, 1.7976931348623157e308, 1);
+    EXPECT_EQ (std::string (beg, end), "1.7e308");
+
+    end = dconv::dtoaApprox (beg, -0.0, 6);
+    EXPECT_EQ (std::string (beg, end), "-0.0");
+
+    std::mt19937_64 gen (42);
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        uint64_t bits = gen ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        if (!std::isfinite (value) || (value == 0.0))
+        {
+            continue;
+        }
+
+        const int significantDigits = 1 + (i % 16);
+        end = dconv::dtoaApprox (beg, value, significantDigits);
+        *end = '\0';
+
+        // within half a unit of the requested digit, plus the rounding of the parsed value.
+        const double parsed = std::strtod (beg, nullptr);
+        const double unit = std::pow (10.0, std::floor (std::log10 (std::fabs (value))) - significantDigits + 1);
+        const double ulp = std::nextafter (std::fabs (value), HUGE_VAL) - std::fabs (value);
+        ASSERT_LE (std::fabs (parsed - value), (unit * (0.5 + 1e-9)) + ulp) << beg << " " << value << " " << significantDigits;
+
+        // never more digits than the shortest roundtrip representation.
+        char full [32];
+        char* last = dconv::dtoa (full, value);
+        ASSERT_LE (significant (beg, end), significant (full, last)) << beg << " " << value;
+
+        // at 16 digits, half a unit is often narrower than the rounding interval and the shortest
+        // roundtrip digits are printed. in the last binade, rounding up may overflow.
+        if ((significantDigits == 16) || (std::fabs (value) >= std::ldexp (1.0, 1023)))
+        {
+            continue;
+        }
+
+        ASSERT_LE (significant (beg, end), static_cast <size_t> (significantDigits)) << beg << " " << value;
+    }
+}
+
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+/**
+ * @brief long double dtoa test.
+ */
+TEST (dtoa, dtoaLongDouble)
+{
+    char beg [48] = {};
+
+    char* end = dconv::dtoa (beg, 0.0L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "0.0");
+
+    end = dconv::dtoa (beg, -0.0L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "-0.0");
+
+    end = dconv::dtoa (beg, 0.1L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "0.1");
+
+    end = dconv::dtoa (beg, -2.5L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "-2.5");
+
+    end = dconv::dtoa (beg, 123456.789L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "123456.789");
+
+    end = dconv::dtoa (beg, 1e4000L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "1e4000");
+
+    end = dconv::dtoa (beg, 1e-4000L);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "1e-4000");
+}
+#endif
+
+#if (LDBL_MANT_DIG == 64)
+/**
+ * @brief x87 extended precision dtoa test.
+ */
+TEST (dtoa, dtoaExtended)
+{
+    char beg [48] = {};
+
+    char* end = dconv::dtoa (beg, 1.0L / 3);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "0.33333333333333333334");
+
+    end = dconv::dtoa (beg, LDBL_MAX);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "1.189731495357231765e4932");
+
+    end = dconv::dtoa (beg, LDBL_MIN);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "3.3621031431120935063e-4932");
+
+    end = dconv::dtoa (beg, __LDBL_DENORM_MIN__);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "4e-4951");
+}
+#endif
+
+#if defined(DCONV_HAS_FLOAT128)
+/**
+ * @brief __float128 dtoa test.
+ */
+TEST (dtoa, dtoaFloat128)
+{
+    using Format = dconv::details::Wide <__float128>;
+    char beg [48] = {};
+
+    char* end = dconv::dtoa (beg, static_cast <__float128> (0));
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "0.0");
+
+    end = dconv::dtoa (beg, static_cast <__float128> (-1.5));
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "-1.5");
+
+    end = dconv::dtoa (beg, static_cast <__float128> (1) / 3);
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "0.3333333333333333333333333333333333");
+
+    end = dconv::dtoa (beg, static_cast <__float128> (0.1));
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "0.1000000000000000055511151231257827");
+
+    end = dconv::dtoa (beg, Format::fromBits (false, Format::_maxExponent - 1, ~static_cast <__uint128_t> (0)));
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "1.189731495357231765085759326628007e4932");
+
+    end = dconv::dtoa (beg, Format::fromBits (true, 0, 1));
+    ASSERT_NE (end, nullptr);
+    EXPECT_STREQ (std::string (beg, end - beg).c_str (), "-6e-4966");
+}
+
+/**
+ * @brief wide cached powers test.
+ */
+TEST (dtoa, dtoapow128)
+{
+    using Format = dconv::details::Wide <__float128>;
+    constexpr int count = sizeof (dconv::details::dtoapow128) / sizeof (dconv::details::dtoapow128[0]);
+
+    for (int exponent = 0; exponent < Format::_maxExponent; ++exponent)
+    {
+        dconv::DiyFp128 value (Format::fromBits (false, exponent, exponent ? Format::_hiddenBit : 1)), minus, plus;
+        value.normalizedBoundaries <__float128> (minus, plus);
+        int mk = dconv::details::kComputation (plus._exponent + 64, -124) - dconv::details::dtoapow128Min;
+        int index = (mk + dconv::details::dtoapow128Step - 1) / dconv::details::dtoapow128Step;
+        ASSERT_GE (index, 0);
+        ASSERT_LT (index, count);
+        int e = plus._exponent + dconv::details::dtoapow128[index]._exponent + 128;
+        ASSERT_GE (e, -124);
+        ASSERT_LE (e, -96);
+    }
+}
+#endif
+
 /**
  * @brief main function.
  */
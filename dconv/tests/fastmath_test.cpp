@@ -0,0 +1,149 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <cstring>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+// this file is built with fast math enabled, the inline conversions must stay exact anyway.
+// the flush to zero mode set by fast math is process wide, subnormal values are not tested.
+
+/**
+ * @brief get the binary representation of a double.
+ * @param value double value.
+ * @return binary representation.
+ */
+static uint64_t bits (double value)
+{
+    uint64_t result;
+    std::memcpy (&result, &value, sizeof (double));
+    return result;
+}
+
+/**
+ * @brief parse a string using the inline implementation.
+ * @param str string to parse.
+ * @param value parsed value.
+ * @return true on success, false otherwise.
+ */
+static bool parse (const std::string& str, double& value)
+{
+    dconv::View view (str.c_str (), str.size ());
+    return dconv::details::atod (view, value) != nullptr;
+}
+
+/**
+ * @brief format a double using the inline implementation.
+ * @param value value to format.
+ * @return formatted string.
+ */
+static std::string format (double value)
+{
+    char buffer[32];
+    char* end = dconv::details::dtoa (buffer, value);
+    return std::string (buffer, end);
+}
+
+TEST (FastMath, defined)
+{
+#if defined(__FAST_MATH__)
+    SUCCEED ();
+#else
+    FAIL () << "fast math is not enabled";
+#endif
+}
+
+TEST (FastMath, kComputation)
+{
+    // smallest k such that 10^k >= 2^n, computed with integers only.
+    for (int n = -1200; n <= 1200; ++n)
+    {
+        // log10 (2) bounds: 0.30102999566398 < log10 (2) < 0.30102999566399.
+        const int64_t lo = static_cast <int64_t> (n) * 30102999566398LL;
+        const int64_t hi = static_cast <int64_t> (n) * 30102999566399LL;
+        const int64_t scale = 100000000000000LL;
+        const int64_t klo = (lo >= 0) ? (lo + scale - 1) / scale : -(-lo / scale);
+        const int64_t khi = (hi >= 0) ? (hi + scale - 1) / scale : -(-hi / scale);
+        ASSERT_EQ (klo, khi) << "n=" << n;
+        EXPECT_EQ (dconv::details::kComputation (63 - n, 0), klo) << "n=" << n;
+    }
+}
+
+TEST (FastMath, atod)
+{
+    const char* corpus[] = {
+        "0", "-0", "1", "-1", "0.1", "0.5", "1.5", "-2.25", "123.456", "3.14159", "1e22", "1e23", "9007199254740993",
+        "1.7976931348623157e308", "2.2250738585072014e-308", "4.35679716e17", "7.3177701707893310e+15",
+        "0.000001", "123456789012345678", "1.00000000000000011102230246251565404236316680908203125",
+        "5e-1", "0.0078125", "1234567.890625", "9.999999999999999e22", "89255.0e-22",
+    };
+
+    for (const char* str : corpus)
+    {
+        double value = 0;
+        ASSERT_TRUE (parse (str, value)) << str;
+        EXPECT_EQ (bits (value), bits (std::strtod (str, nullptr))) << str;
+    }
+}
+
+TEST (FastMath, random)
+{
+    std::mt19937_64 rng (2025);
+    std::uniform_int_distribution <uint64_t> significand (0, (1ULL << 52) - 1);
+    std::uniform_int_distribution <uint64_t> exponent (1, 2046);
+    char str[64];
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t b = (static_cast <uint64_t> (i & 1) << 63) | (exponent (rng) << 52) | significand (rng);
+        double expected;
+        std::memcpy (&expected, &b, sizeof (double));
+
+        // shortest roundtrip.
+        const std::string shortest = format (expected);
+        double value = 0;
+        ASSERT_TRUE (parse (shortest, value)) << shortest;
+        EXPECT_EQ (bits (value), b) << shortest;
+
+        // short decimals, as found in real data.
+        std::snprintf (str, sizeof (str), "%.*g", static_cast <int> (1 + (i % 17)), expected);
+        ASSERT_TRUE (parse (str, value)) << str;
+        EXPECT_EQ (bits (value), bits (std::strtod (str, nullptr))) << str;
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,185 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/field.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+
+/**
+ * @brief parse a field and compare with atod on the trimmed field.
+ * @param field field to parse.
+ */
+template <size_t N>
+static void expectField (const std::string& field)
+{
+    ASSERT_EQ (field.size (), N);
+
+    std::string trimmed = field;
+    trimmed.erase (0, trimmed.find_first_not_of (' '));
+    trimmed.erase (trimmed.find_last_not_of (' ') + 1);
+
+    // atod grammar has no plus sign, leading zeros, leading or trailing dot.
+    std::string sign;
+    if (trimmed[0] == '-' || trimmed[0] == '+')
+    {
+        sign = (trimmed[0] == '-') ? "-" : "";
+        trimmed.erase (0, 1);
+    }
+    trimmed.erase (0, trimmed.find_first_not_of ('0'));
+    if (trimmed.empty () || trimmed[0] == '.')
+    {
+        trimmed.insert (0, 1, '0');
+    }
+    if (trimmed.back () == '.')
+    {
+        trimmed += '0';
+    }
+    trimmed.insert (0, sign);
+
+    double expected = 0.0, value = 0.0;
+    ASSERT_NE (dconv::atod (trimmed.c_str (), expected), nullptr) << field;
+    ASSERT_EQ (dconv::atodFixed <N> (field.data (), value), field.data () + N) << field;
+    EXPECT_EQ (value, expected) << field;
+    EXPECT_EQ (std::signbit (value), std::signbit (expected)) << field;
+}
+
+/**
+ * @brief fixed width field parsing test.
+ */
+TEST (field, atodFixed)
+{
+    double value = 0.0;
+
+    expectField <1> ("7");
+    expectField <1> ("0");
+    expectField <8> ("   -12.5");
+    expectField <8> ("+12.5   ");
+    expectField <8> ("  0.125 ");
+    expectField <8> ("00001234");
+    expectField <8> ("   -.5  ");
+    expectField <8> ("   12.  ");
+    expectField <8> ("    -0.0");
+    expectField <12> ("  3.14159265");
+    expectField <12> ("-99999999999");
+    expectField <16> ("1234567890123456");
+    expectField <16> ("   -1234567.8901");
+    expectField <16> ("0.00000000012345");
+    expectField <24> ("     123456789012345.678");
+    expectField <24> ("12345678901234567890.123");
+    expectField <24> ("0.0000000000000000000001");
+    expectField <24> ("-00000000000000000000001");
+    expectField <64> (std::string (40, ' ') + "-1234.5678901234567" + std::string (5, ' '));
+    expectField <64> ("0." + std::string (61, '0') + "1");
+    expectField <64> (std::string (64, '9'));
+
+    EXPECT_EQ (dconv::atodFixed <1> (" ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("        ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("   -    ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("   .    ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  1 2   ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  1.2.3 ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  1-2   ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  --12  ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  12-   ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  1e5   ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("  nan   ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <8> ("12\t     ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <16> (std::string (15, ' ').append ("x").data (), value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <24> ("1  2                    ", value), nullptr);
+    EXPECT_EQ (dconv::atodFixed <64> ((std::string (63, ' ') + "+").data (), value), nullptr);
+}
+
+/**
+ * @brief generate a random field.
+ * @param rng random generator.
+ * @return random field.
+ */
+template <size_t N>
+static std::string randomField (std::mt19937_64& rng)
+{
+    std::string content;
+
+    if (rng () % 2)
+    {
+        content += (rng () % 2) ? '-' : '+';
+    }
+
+    size_t digits = 1 + rng () % N;
+    size_t dot = rng () % (digits + 2);
+
+    for (size_t i = 0; i < digits; ++i)
+    {
+        if (i == dot)
+        {
+            content += '.';
+        }
+        content += static_cast <char> ('0' + rng () % 10);
+    }
+
+    if (content.size () > N)
+    {
+        content.resize (N);
+    }
+
+    if (content.find_first_of ("0123456789") == std::string::npos)
+    {
+        content.back () = '1';
+    }
+
+    size_t padding = N - content.size ();
+    size_t left = rng () % (padding + 1);
+
+    return std::string (left, ' ') + content + std::string (padding - left, ' ');
+}
+
+/**
+ * @brief fixed width field random test.
+ */
+TEST (field, random)
+{
+    std::mt19937_64 rng;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        expectField <3> (randomField <3> (rng));
+        expectField <8> (randomField <8> (rng));
+        expectField <13> (randomField <13> (rng));
+        expectField <16> (randomField <16> (rng));
+        expectField <21> (randomField <21> (rng));
+        expectField <32> (randomField <32> (rng));
+        expectField <64> (randomField <64> (rng));
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,234 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/fixed.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+/**
+ * @brief atofixed test.
+ */
+TEST (fixed, atofixed)
+{
+    int64_t value = 0;
+
+    EXPECT_EQ (dconv::atofixed ("", 4, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("003", 4, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("1.", 4, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("inf", 4, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("nan", 4, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("92233720368547758070", 0, value), nullptr);
+
+    ASSERT_NE (dconv::atofixed ("1234567890123456789.5", 0, value), nullptr);
+    EXPECT_EQ (value, 1234567890123456790);
+
+    ASSERT_NE (dconv::atofixed ("1234567890123456788.5", 0, value), nullptr);
+    EXPECT_EQ (value, 1234567890123456788);
+
+    ASSERT_NE (dconv::atofixed ("1234567890123456788.50001", 0, value), nullptr);
+    EXPECT_EQ (value, 1234567890123456789);
+
+    ASSERT_NE (dconv::atofixed ("1234567890123456789.6", 0, value), nullptr);
+    EXPECT_EQ (value, 1234567890123456790);
+
+    ASSERT_NE (dconv::atofixed ("-1234567890123456789.4999", 0, value), nullptr);
+    EXPECT_EQ (value, -1234567890123456789);
+
+    ASSERT_NE (dconv::atofixed ("1.00000000000000000001", 18, value), nullptr);
+    EXPECT_EQ (value, 1000000000000000000);
+
+    ASSERT_NE (dconv::atofixed ("0.0001234567890123456789612e3", 19, value), nullptr);
+    EXPECT_EQ (value, 1234567890123456790);
+
+    EXPECT_EQ (dconv::atofixed ("9223372036854775807.5", 0, value), nullptr);
+
+    ASSERT_NE (dconv::atofixed ("0.000000000000000000000000000001", 4, value), nullptr);
+    EXPECT_EQ (value, 0);
+
+    ASSERT_NE (dconv::atofixed ("1.00000000000000000000000000000", 4, value), nullptr);
+    EXPECT_EQ (value, 10000);
+
+    ASSERT_NE (dconv::atofixed ("1.23445000000000000000000000001", 4, value), nullptr);
+    EXPECT_EQ (value, 12345);
+
+    ASSERT_NE (dconv::atofixed ("-1.23444999999999999999999999999", 4, value), nullptr);
+    EXPECT_EQ (value, -12344);
+
+    ASSERT_NE (dconv::atofixed ("0", 4, value), nullptr);
+    EXPECT_EQ (value, 0);
+
+    ASSERT_NE (dconv::atofixed ("-0.0", 4, value), nullptr);
+    EXPECT_EQ (value, 0);
+
+    ASSERT_NE (dconv::atofixed ("12345.6789", 4, value), nullptr);
+    EXPECT_EQ (value, 123456789);
+
+    ASSERT_NE (dconv::atofixed ("-12345.6789", 4, value), nullptr);
+    EXPECT_EQ (value, -123456789);
+
+    ASSERT_NE (dconv::atofixed ("1234.5678", 8, value), nullptr);
+    EXPECT_EQ (value, 123456780000);
+
+    ASSERT_NE (dconv::atofixed ("1.2345678e3", 8, value), nullptr);
+    EXPECT_EQ (value, 123456780000);
+
+    ASSERT_NE (dconv::atofixed ("12", 0, value), nullptr);
+    EXPECT_EQ (value, 12);
+
+    ASSERT_NE (dconv::atofixed ("1200", -2, value), nullptr);
+    EXPECT_EQ (value, 12);
+
+    ASSERT_NE (dconv::atofixed ("0.00001", 4, value), nullptr);
+    EXPECT_EQ (value, 0);
+
+    ASSERT_NE (dconv::atofixed ("0.00005", 4, value), nullptr);
+    EXPECT_EQ (value, 0);
+
+    ASSERT_NE (dconv::atofixed ("0.00015", 4, value), nullptr);
+    EXPECT_EQ (value, 2);
+
+    ASSERT_NE (dconv::atofixed ("0.000051", 4, value), nullptr);
+    EXPECT_EQ (value, 1);
+
+    ASSERT_NE (dconv::atofixed ("-0.000051", 4, value), nullptr);
+    EXPECT_EQ (value, -1);
+
+    ASSERT_NE (dconv::atofixed ("1e-30", 4, value), nullptr);
+    EXPECT_EQ (value, 0);
+
+    ASSERT_NE (dconv::atofixed ("9223372036854775807", 0, value), nullptr);
+    EXPECT_EQ (value, INT64_MAX);
+
+    ASSERT_NE (dconv::atofixed ("-9223372036854775808", 0, value), nullptr);
+    EXPECT_EQ (value, INT64_MIN);
+
+    ASSERT_NE (dconv::atofixed ("-922337203.6854775808", 10, value), nullptr);
+    EXPECT_EQ (value, INT64_MIN);
+
+    EXPECT_EQ (dconv::atofixed ("9223372036854775808", 0, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("922337203.6854775808", 10, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("1e19", 0, value), nullptr);
+
+    EXPECT_EQ (dconv::atofixed ("1", 20, value), nullptr);
+
+    const char str[] = "1234.5678,9";
+    const char* end = dconv::atofixed (str, 4, value);
+    ASSERT_EQ (end, str + 9);
+    EXPECT_EQ (value, 12345678);
+
+    end = dconv::atofixed (str, 6, 2, value);
+    ASSERT_EQ (end, str + 6);
+    EXPECT_EQ (value, 123450);
+
+    end = dconv::atofixed (str + 10, str + 11, 2, value);
+    ASSERT_EQ (end, str + 11);
+    EXPECT_EQ (value, 900);
+}
+
+/**
+ * @brief main function.
+ */
+/**
+ * @brief fixedtoa test.
+ */
+TEST (fixed, fixedtoa)
+{
+    char beg [64] = {};
+    char* end = nullptr;
+
+    end = dconv::fixedtoa (beg, 0, 4, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "0.0000");
+
+    end = dconv::fixedtoa (beg, 0, 0, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "0.0");
+
+    end = dconv::fixedtoa (beg, 0, 4, dconv::FixedTrimZeros);
+    EXPECT_EQ (std::string (beg, end - beg), "0.0");
+
+    end = dconv::fixedtoa (beg, 123456789, 4, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "12345.6789");
+
+    end = dconv::fixedtoa (beg, -123456789, 4, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "-12345.6789");
+
+    end = dconv::fixedtoa (beg, 5, 4, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "0.0005");
+
+    end = dconv::fixedtoa (beg, -5, 10, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "-0.0000000005");
+
+    end = dconv::fixedtoa (beg, 1234500, 4, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "123.4500");
+
+    end = dconv::fixedtoa (beg, 1234500, 4, dconv::FixedTrimZeros);
+    EXPECT_EQ (std::string (beg, end - beg), "123.45");
+
+    end = dconv::fixedtoa (beg, 120000, 4, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "12.0000");
+
+    end = dconv::fixedtoa (beg, 120000, 4, dconv::FixedTrimZeros);
+    EXPECT_EQ (std::string (beg, end - beg), "12.0");
+
+    end = dconv::fixedtoa (beg, 12, 0, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "12.0");
+
+    end = dconv::fixedtoa (beg, 12, -3, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "12000.0");
+
+    end = dconv::fixedtoa (beg, INT64_MAX, 0, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "9223372036854775807.0");
+
+    end = dconv::fixedtoa (beg, INT64_MIN, 18, dconv::FixedDefault);
+    EXPECT_EQ (std::string (beg, end - beg), "-9.223372036854775808");
+
+    end = dconv::fixedtoa (beg, INT64_MIN, 25, dconv::FixedTrimZeros);
+    EXPECT_EQ (std::string (beg, end - beg), "-0.0000009223372036854775808");
+
+    int64_t value = 0;
+    for (int64_t expected : {int64_t (0), int64_t (1), int64_t (-7), int64_t (1000), int64_t (123456789), INT64_MAX, INT64_MIN})
+    {
+        for (int scale : {1, 2, 8, 19})
+        {
+            end = dconv::fixedtoa (beg, expected, scale);
+            *end = '\0';
+            ASSERT_NE (dconv::atofixed (beg, scale, value), nullptr);
+            EXPECT_EQ (value, expected);
+        }
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,277 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/half.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <algorithm>
+#include <random>
+#include <string>
+#include <cmath>
+
+#if defined(DCONV_HAS_FLOAT128)
+/**
+ * @brief round a binary128 to a narrow floating point (reference conversion).
+ * @param value binary128 value.
+ * @return narrow floating point.
+ */
+template <typename Narrow>
+static uint16_t reference (__float128 value)
+{
+    const uint16_t sign = (value < 0) ? 0x8000 : 0;
+    const uint16_t infinity = Narrow::_maxExponent << Narrow::_fractionSize;
+    value = (value < 0) ? -value : value;
+
+    // candidates are exact in binary128, and so are their distances to the value.
+    // overflow rounds like a value of 2^emax with an even mantissa.
+    const int guess = Narrow (static_cast <double> (value)).bits () & 0x7FFF;
+    uint16_t best = 0;
+    __float128 distance = -1;
+
+    for (int candidate = std::max (guess - 1, 0); candidate <= std::min (guess + 1, static_cast <int> (infinity)); ++candidate)
+    {
+        const __float128 c = (candidate == infinity) ? std::ldexp (1.0, Narrow::_maxExponent - Narrow::_exponentBias)
+                                                     : static_cast <double> (Narrow::fromBits (static_cast <uint16_t> (candidate)));
+        const __float128 d = (value > c) ? value - c : c - value;
+
+        if ((distance < 0) || (d < distance) || ((d == distance) && ((candidate & 1) == 0)))
+        {
+            best = static_cast <uint16_t> (candidate);
+            distance = d;
+        }
+    }
+
+    return sign | best;
+}
+#endif
+
+/**
+ * @brief parse a narrow floating point.
+ * @param str string to parse.
+ * @return bit pattern.
+ */
+template <typename Narrow>
+static uint16_t parse (const std::string& str)
+{
+    Narrow value;
+    const char* end = dconv::atod (str.c_str (), value);
+    EXPECT_EQ (end, str.c_str () + str.size ()) << str;
+    return value.bits ();
+}
+
+/**
+ * @brief print a narrow floating point.
+ * @param bits bit pattern.
+ * @return string representation.
+ */
+template <typename Narrow>
+static std::string print (uint16_t bits)
+{
+    char buffer [32];
+    char* end = dconv::dtoa (buffer, Narrow::fromBits (bits));
+    return std::string (buffer, end);
+}
+
+/**
+ * @brief half test.
+ */
+TEST (half, atod)
+{
+    dconv::Half value;
+
+    EXPECT_EQ (dconv::atod ("", value), nullptr);
+    EXPECT_EQ (dconv::atod ("+1", value), nullptr);
+    EXPECT_EQ (dconv::atod ("1e", value), nullptr);
+
+    EXPECT_EQ (parse <dconv::Half> ("0"), 0x0000);
+    EXPECT_EQ (parse <dconv::Half> ("-0.0"), 0x8000);
+    EXPECT_EQ (parse <dconv::Half> ("1"), 0x3C00);
+    EXPECT_EQ (parse <dconv::Half> ("0.1"), 0x2E66);
+    EXPECT_EQ (parse <dconv::Half> ("-2.5"), 0xC100);
+    EXPECT_EQ (parse <dconv::Half> ("65504"), 0x7BFF);
+    EXPECT_EQ (parse <dconv::Half> ("65519.99"), 0x7BFF);
+    EXPECT_EQ (parse <dconv::Half> ("65520"), 0x7C00);
+    EXPECT_EQ (parse <dconv::Half> ("1e300"), 0x7C00);
+    EXPECT_EQ (parse <dconv::Half> ("1e-300"), 0x0000);
+    EXPECT_EQ (parse <dconv::Half> ("6.103515625e-5"), 0x0400);
+    EXPECT_EQ (parse <dconv::Half> ("5.960464477539063e-8"), 0x0001);
+    EXPECT_EQ (parse <dconv::Half> ("2.98023223876953125e-8"), 0x0000);
+    EXPECT_EQ (parse <dconv::Half> ("2.98023223876953125000000001e-8"), 0x0001);
+    EXPECT_EQ (parse <dconv::Half> ("8.94069671630859375e-8"), 0x0002);
+    EXPECT_EQ (parse <dconv::Half> ("1.00048828125"), 0x3C00);
+    EXPECT_EQ (parse <dconv::Half> ("1.00048828125000000000000001"), 0x3C01);
+    EXPECT_EQ (parse <dconv::Half> ("-inf"), 0xFC00);
+    EXPECT_EQ (parse <dconv::Half> ("nan"), 0x7E00);
+}
+
+/**
+ * @brief bfloat16 test.
+ */
+TEST (bfloat16, atod)
+{
+    EXPECT_EQ (parse <dconv::BFloat16> ("1"), 0x3F80);
+    EXPECT_EQ (parse <dconv::BFloat16> ("-2"), 0xC000);
+    EXPECT_EQ (parse <dconv::BFloat16> ("0.1"), 0x3DCD);
+    EXPECT_EQ (parse <dconv::BFloat16> ("3.3895313892515355e38"), 0x7F7F);
+    EXPECT_EQ (parse <dconv::BFloat16> ("3.40e38"), 0x7F80);
+    EXPECT_EQ (parse <dconv::BFloat16> ("9.183549615799121e-41"), 0x0001);
+    EXPECT_EQ (parse <dconv::BFloat16> ("1.00390625"), 0x3F80);
+    EXPECT_EQ (parse <dconv::BFloat16> ("1.01171875"), 0x3F82);
+}
+
+/**
+ * @brief narrow printing test.
+ */
+TEST (half, dtoa)
+{
+    EXPECT_EQ (print <dconv::Half> (0x0000), "0.0");
+    EXPECT_EQ (print <dconv::Half> (0x8000), "-0.0");
+    EXPECT_EQ (print <dconv::Half> (0x3C00), "1.0");
+    EXPECT_EQ (print <dconv::Half> (0x2E66), "0.1");
+    EXPECT_EQ (print <dconv::Half> (0x7BFF), "65500.0");
+    EXPECT_EQ (print <dconv::Half> (0x0001), "6e-8");
+    EXPECT_EQ (print <dconv::Half> (0x7C00), "inf");
+    EXPECT_EQ (print <dconv::Half> (0xFC00), "-inf");
+    EXPECT_EQ (print <dconv::Half> (0x7E00), "nan");
+
+    EXPECT_EQ (print <dconv::BFloat16> (0x3F80), "1.0");
+    EXPECT_EQ (print <dconv::BFloat16> (0x3DCD), "0.1");
+    EXPECT_EQ (print <dconv::BFloat16> (0x7F7F), "3.39e38");
+}
+
+/**
+ * @brief round a double and widen it back.
+ */
+TEST (half, convert)
+{
+    EXPECT_EQ (dconv::Half (0.1).bits (), 0x2E66);
+    EXPECT_EQ (dconv::Half (65520.0).bits (), 0x7C00);
+    EXPECT_EQ (dconv::Half (-1e-10).bits (), 0x8000);
+    EXPECT_EQ (dconv::BFloat16 (1.0).bits (), 0x3F80);
+    EXPECT_EQ (static_cast <double> (dconv::Half::fromBits (0x3555)), 0.333251953125);
+    EXPECT_EQ (static_cast <double> (dconv::BFloat16::fromBits (0xC049)), -3.140625);
+}
+
+/**
+ * @brief all the narrow floating points parse back from their shortest representation.
+ */
+template <typename Narrow>
+static void roundtrip ()
+{
+    for (uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+    {
+        const Narrow value = Narrow::fromBits (static_cast <uint16_t> (bits));
+
+        if (std::isnan (static_cast <double> (value)))
+        {
+            continue;
+        }
+
+        const std::string str = print <Narrow> (static_cast <uint16_t> (bits));
+        ASSERT_EQ (parse <Narrow> (str), bits) << str;
+
+        // no shorter representation parses back.
+        if (std::isfinite (static_cast <double> (value)) && (bits & 0x7FFF))
+        {
+            char buffer [32];
+            size_t digits = 0;
+            for (char c : str.substr (0, str.find ('e')))
+            {
+                digits += (c >= '0' && c <= '9');
+            }
+            for (char c : str.substr (0, str.find ('e')))
+            {
+                if (c != '0' && c != '.' && c != '-') break;
+                digits -= (c == '0');
+            }
+            for (size_t i = str.find ('e') == std::string::npos ? str.size () : str.find ('e'); i > 0 && (str[i - 1] == '0' || str[i - 1] == '.'); --i)
+            {
+                digits -= (str[i - 1] == '0');
+            }
+            if (digits > 1)
+            {
+                snprintf (buffer, sizeof (buffer), "%.*e", static_cast <int> (digits - 2), static_cast <double> (value));
+                ASSERT_NE (parse <Narrow> (buffer), bits) << str << " " << buffer;
+            }
+        }
+    }
+}
+
+TEST (half, roundtrip)
+{
+    roundtrip <dconv::Half> ();
+}
+
+TEST (bfloat16, roundtrip)
+{
+    roundtrip <dconv::BFloat16> ();
+}
+
+#if defined(DCONV_HAS_FLOAT128)
+/**
+ * @brief random decimal strings are rounded once.
+ */
+template <typename Narrow>
+static void random (int minMagnitude, int maxMagnitude)
+{
+    std::mt19937_64 gen (42);
+    std::uniform_int_distribution <int> magnitudes (minMagnitude, maxMagnitude);
+    char buffer [64];
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        const int digits = 1 + gen () % 25;
+        int len = 0;
+        for (int j = 0; j < digits; ++j)
+        {
+            buffer[len++] = '0' + ((j == 0) ? 1 + gen () % 9 : gen () % 10);
+        }
+        len += snprintf (buffer + len, sizeof (buffer) - len, "e%d", magnitudes (gen) - digits + 1);
+
+        __float128 wide;
+        ASSERT_NE (dconv::atod (buffer, wide), nullptr);
+        ASSERT_EQ (parse <Narrow> (buffer), reference <Narrow> (wide)) << buffer;
+    }
+}
+
+TEST (half, random)
+{
+    random <dconv::Half> (-9, 5);
+}
+
+TEST (bfloat16, random)
+{
+    random <dconv::BFloat16> (-42, 39);
+}
+#endif
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,155 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/json.hpp>
+#include <dconv/dtoa.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief parse a JSON array.
+ * @param json JSON array.
+ * @param values parsed values.
+ * @return true on success.
+ */
+static bool parse (const std::string& json, std::vector <double>& values)
+{
+    values.clear ();
+    const char* end = dconv::parseJsonArray (json.data (), json.data () + json.size (), values);
+    return end != nullptr;
+}
+
+/**
+ * @brief JSON array test.
+ */
+TEST (json, parseJsonArray)
+{
+    std::vector <double> values;
+
+    EXPECT_TRUE (parse ("[]", values));
+    EXPECT_TRUE (values.empty ());
+
+    EXPECT_TRUE (parse (" \n[ \t ]", values));
+    EXPECT_TRUE (values.empty ());
+
+    EXPECT_TRUE (parse ("[1.5,-2e3,0.25]", values));
+    EXPECT_EQ (values, std::vector <double> ({1.5, -2e3, 0.25}));
+
+    EXPECT_TRUE (parse ("[\n    0,\n    -0.0,\n    1E+2,\n    1e-2\r\n]", values));
+    EXPECT_EQ (values, std::vector <double> ({0.0, -0.0, 1e2, 1e-2}));
+    EXPECT_TRUE (std::signbit (values[1]));
+
+    EXPECT_TRUE (parse ("[" + std::string (100, ' ') + "42" + std::string (37, '\t') + "]", values));
+    EXPECT_EQ (values, std::vector <double> ({42.0}));
+
+    EXPECT_TRUE (parse ("[123456789012345678901234567890, 0.1234567890123456789012345, 1e400, -1e-400]", values));
+    ASSERT_EQ (values.size (), 4);
+    EXPECT_EQ (values[0], 123456789012345678901234567890.0);
+    EXPECT_EQ (values[1], 0.1234567890123456789012345);
+    EXPECT_EQ (values[2], std::numeric_limits <double>::infinity ());
+    EXPECT_EQ (values[3], -0.0);
+
+    std::string json = "[1, 2, 3] trailing";
+    EXPECT_EQ (dconv::parseJsonArray (json.data (), json.data () + json.size (), values), json.data () + 9);
+
+    for (const char* invalid : {"", "[", "]", "1", "[1", "[1,", "[1,]", "[,1]", "[1 2]", "[1;2]", "[01]", "[-01]", "[1.]",
+        "[.5]", "[+1]", "[-]", "[1e]", "[1e+]", "[--1]", "[inf]", "[nan]", "[Infinity]", "[\"1\"]", "[null]", "[[1]]",
+        "[1\v]", "[123456789012345678901234.]", "[123456789012345678901234e]", "[123456789012345678901234"})
+    {
+        EXPECT_FALSE (parse (invalid, values)) << invalid;
+    }
+}
+
+/**
+ * @brief JSON array caller buffer test.
+ */
+TEST (json, buffer)
+{
+    double buffer[4] = {};
+    std::string json = "[0.5, 1.5, 2.5]";
+
+    EXPECT_EQ (dconv::parseJsonArray (json.data (), json.data () + json.size (), buffer), json.data () + json.size ());
+    EXPECT_EQ (buffer[0], 0.5);
+    EXPECT_EQ (buffer[1], 1.5);
+    EXPECT_EQ (buffer[2], 2.5);
+    EXPECT_EQ (buffer[3], 0.0);
+}
+
+/**
+ * @brief JSON array random test.
+ */
+TEST (json, random)
+{
+    std::mt19937_64 rng;
+    std::vector <double> expected, values;
+    const char* spaces[] = {"", " ", "\n", "\r\n  ", "\n" "                    ", "\t\t"};
+
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string json = "[";
+        expected.clear ();
+
+        for (int j = 0, count = rng () % 200; j < count; ++j)
+        {
+            uint64_t bits = rng ();
+            double value;
+            memcpy (&value, &bits, sizeof (double));
+
+            if (!std::isfinite (value))
+            {
+                continue;
+            }
+
+            char buffer[32];
+            json += (expected.empty () ? "" : ",");
+            json += spaces[rng () % 6];
+            json.append (buffer, dconv::dtoa (buffer, value) - buffer);
+            json += spaces[rng () % 6];
+            expected.push_back (value);
+        }
+
+        json += "]";
+
+        ASSERT_TRUE (parse (json, values)) << json;
+        ASSERT_EQ (values.size (), expected.size ());
+
+        for (size_t j = 0; j < values.size (); ++j)
+        {
+            EXPECT_EQ (memcmp (&values[j], &expected[j], sizeof (double)), 0) << values[j] << " " << expected[j];
+        }
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,226 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+#include <dconv/fixed.hpp>
+#include <dconv/json.hpp>
+#include <dconv/number.hpp>
+#include <dconv/decimal.hpp>
+#include <dconv/scan.hpp>
+#include <dconv/csv.hpp>
+#include <dconv/half.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <random>
+#include <string>
+
+// this file is built with DCONV_NO_INT128, it runs the code used on 32-bit targets.
+// the compiler still provides 128-bit integers, they are used as reference.
+
+/**
+ * @brief get the binary representation of a double.
+ * @param value double value.
+ * @return binary representation.
+ */
+static uint64_t bits (double value)
+{
+    uint64_t result;
+    std::memcpy (&result, &value, sizeof (double));
+    return result;
+}
+
+TEST (NoInt128, defined)
+{
+#if defined(DCONV_HAS_INT128) || defined(DCONV_HAS_WIDE_LONG_DOUBLE) || defined(DCONV_HAS_FLOAT128)
+    FAIL () << "128-bit integer paths are enabled";
+#else
+    SUCCEED ();
+#endif
+}
+
+TEST (NoInt128, umul128)
+{
+    std::mt19937_64 rng (2025);
+    const uint64_t edges[] = {0, 1, 0xFFFFFFFF, 0x100000000, 0x8000000000000000, ~static_cast <uint64_t> (0)};
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t a = (i < 36) ? edges[i / 6] : rng ();
+        const uint64_t b = (i < 36) ? edges[i % 6] : rng ();
+        const unsigned __int128 expected = static_cast <unsigned __int128> (a) * b;
+
+        uint64_t high = 0;
+        const uint64_t low = dconv::details::umul128 (a, b, high);
+        EXPECT_EQ (high, static_cast <uint64_t> (expected >> 64));
+        EXPECT_EQ (low, static_cast <uint64_t> (expected));
+    }
+}
+
+TEST (NoInt128, umul192)
+{
+    std::mt19937_64 rng (2025);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t hi = rng (), lo = rng (), significand = rng () >> (i % 64);
+        const unsigned __int128 h = static_cast <unsigned __int128> (hi) * significand;
+        const unsigned __int128 l = static_cast <unsigned __int128> (lo) * significand;
+        const unsigned __int128 s = h + (l >> 64);
+
+        uint64_t high = 0, middle = 0, low = 0;
+        dconv::details::umul192 (hi, lo, significand, high, middle, low);
+        EXPECT_EQ (high, static_cast <uint64_t> (s >> 64));
+        EXPECT_EQ (middle, static_cast <uint64_t> (s));
+        EXPECT_EQ (low, static_cast <uint64_t> (l));
+    }
+}
+
+TEST (NoInt128, diyfp)
+{
+    std::mt19937_64 rng (2025);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t a = rng (), b = rng ();
+        const unsigned __int128 product = static_cast <unsigned __int128> (a) * b;
+
+        dconv::DiyFp x (a, 0);
+        x *= dconv::DiyFp (b, 0);
+        EXPECT_EQ (x._mantissa, static_cast <uint64_t> ((product >> 64) + ((product >> 63) & 1)));
+        EXPECT_EQ (x._exponent, 64);
+    }
+}
+
+TEST (NoInt128, atod)
+{
+    // exact, Eisel-Lemire, halfway and slow path inputs.
+    const char* corpus[] = {
+        "0", "-0", "1", "0.1", "1.5", "123.456", "1e22", "1e23", "9007199254740993", "9007199254740995",
+        "1.7976931348623157e308", "2.2250738585072014e-308", "4.9406564584124654e-324", "4.35679716e17",
+        "7.3177701707893310e+15", "2.2250738585072011e-308", "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124", "89255.0e-22", "123456789012345678e-300",
+    };
+
+    for (const char* str : corpus)
+    {
+        double value = 0;
+        ASSERT_NE (dconv::atod (str, value), nullptr) << str;
+        EXPECT_EQ (bits (value), bits (std::strtod (str, nullptr))) << str;
+    }
+}
+
+TEST (NoInt128, random)
+{
+    std::mt19937_64 rng (2025);
+    char str[96], buffer[32];
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        const uint64_t b = (rng () & ~(static_cast <uint64_t> (0x7FF) << 52)) | ((1 + rng () % 2046) << 52);
+        double expected;
+        std::memcpy (&expected, &b, sizeof (double));
+
+        // shortest roundtrip.
+        char* end = dconv::dtoa (buffer, expected);
+        *end = '\0';
+        double value = 0;
+        ASSERT_NE (dconv::atod (buffer, value), nullptr) << buffer;
+        EXPECT_EQ (bits (value), b) << buffer;
+
+        // 17 digits, the midpoint of two doubles and short decimals.
+        const long double midpoint = (static_cast <long double> (expected) + std::nextafter (expected, 0.0)) / 2;
+        std::snprintf (str, sizeof (str), "%.*Le", (i % 3 == 0) ? 16 : ((i % 3 == 1) ? 40 : static_cast <int> (i % 17)),
+                       (i % 3 == 1) ? midpoint : static_cast <long double> (expected));
+        ASSERT_NE (dconv::atod (str, value), nullptr) << str;
+        EXPECT_EQ (bits (value), bits (std::strtod (str, nullptr))) << str;
+    }
+}
+
+/**
+ * @brief check the conversions of every finite narrow floating point and of the midpoints between them.
+ */
+template <typename Narrow>
+static void narrowRoundtrip ()
+{
+    char str[192], buffer[32];
+
+    for (uint32_t b = 0; b < 0x8000; ++b)
+    {
+        const Narrow value = Narrow::fromBits (static_cast <uint16_t> (b));
+        const uint16_t exponent = (b >> Narrow::_fractionSize) & Narrow::_maxExponent;
+
+        if (exponent == Narrow::_maxExponent)
+        {
+            continue;
+        }
+
+        // shortest roundtrip.
+        char* end = dconv::dtoa (buffer, value);
+        *end = '\0';
+        Narrow parsed;
+        ASSERT_NE (dconv::atod (buffer, parsed), nullptr) << buffer;
+        EXPECT_EQ (parsed.bits (), b) << buffer;
+        EXPECT_EQ (Narrow (static_cast <double> (value)).bits (), b);
+
+        // midpoints are exact in double and printed exactly, ties go to even and anything above goes up.
+        const double lower = static_cast <double> (value);
+        const double upper = (b + 1 < (static_cast <uint32_t> (Narrow::_maxExponent) << Narrow::_fractionSize))
+                           ? static_cast <double> (Narrow::fromBits (static_cast <uint16_t> (b + 1)))
+                           : std::ldexp (1.0, Narrow::_maxExponent - Narrow::_exponentBias);
+        std::snprintf (str, sizeof (str) - 3, "%.150g", (lower + upper) / 2);
+        ASSERT_NE (dconv::atod (str, parsed), nullptr) << str;
+        EXPECT_EQ (parsed.bits (), b + (b & 1)) << str;
+
+        if (std::strchr (str, 'e') == nullptr)
+        {
+            std::strcat (str, (std::strchr (str, '.') == nullptr) ? ".1" : "1");
+            ASSERT_NE (dconv::atod (str, parsed), nullptr) << str;
+            EXPECT_EQ (parsed.bits (), b + 1) << str;
+        }
+    }
+}
+
+TEST (NoInt128, half)
+{
+    narrowRoundtrip <dconv::Half> ();
+}
+
+TEST (NoInt128, bfloat16)
+{
+    narrowRoundtrip <dconv::BFloat16> ();
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,203 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/number.hpp>
+#include <dconv/dtoa.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+#include <limits>
+#include <cmath>
+
+// C.
+#include <cstring>
+
+/**
+ * @brief parse an integer.
+ * @param str string to parse.
+ * @param type expected type.
+ * @param value expected value.
+ */
+static void expectInteger (const std::string& str, dconv::NumberType type, uint64_t value)
+{
+    dconv::Number number;
+    dconv::View view (str.data (), str.size ());
+
+    ASSERT_TRUE (dconv::parseNumber (view, number)) << str;
+    ASSERT_EQ (number._type, type) << str;
+    if (type == dconv::NumberInt64)
+    {
+        EXPECT_EQ (number._int64, static_cast <int64_t> (value)) << str;
+    }
+    else
+    {
+        EXPECT_EQ (number._uint64, value) << str;
+    }
+    EXPECT_EQ (view.size (), 0) << str;
+}
+
+/**
+ * @brief parse a double.
+ * @param str string to parse.
+ */
+static void expectDouble (const std::string& str)
+{
+    dconv::Number number;
+    dconv::View view (str.data (), str.size ());
+    double expected;
+
+    ASSERT_NE (dconv::atod (str.c_str (), expected), nullptr) << str;
+    ASSERT_TRUE (dconv::parseNumber (view, number)) << str;
+    ASSERT_EQ (number._type, dconv::NumberDouble) << str;
+    EXPECT_TRUE ((number._double == expected) || (std::isnan (number._double) && std::isnan (expected))) << str;
+    EXPECT_EQ (std::signbit (number._double), std::signbit (expected)) << str;
+    EXPECT_EQ (view.size (), 0) << str;
+}
+
+/**
+ * @brief integer test.
+ */
+TEST (number, integer)
+{
+    expectInteger ("0", dconv::NumberInt64, 0);
+    expectInteger ("-0", dconv::NumberInt64, 0);
+    expectInteger ("42", dconv::NumberInt64, 42);
+    expectInteger ("-42", dconv::NumberInt64, static_cast <uint64_t> (-42));
+    expectInteger ("1234567890123456789", dconv::NumberInt64, 1234567890123456789ULL);
+    expectInteger ("9223372036854775807", dconv::NumberInt64, 9223372036854775807ULL);
+    expectInteger ("-9223372036854775808", dconv::NumberInt64, 9223372036854775808ULL);
+    expectInteger ("9223372036854775808", dconv::NumberUInt64, 9223372036854775808ULL);
+    expectInteger ("12345678901234567890", dconv::NumberUInt64, 12345678901234567890ULL);
+    expectInteger ("12345678901234567891", dconv::NumberUInt64, 12345678901234567891ULL);
+    expectInteger ("18446744073709551615", dconv::NumberUInt64, 18446744073709551615ULL);
+}
+
+/**
+ * @brief double test.
+ */
+TEST (number, floating)
+{
+    expectDouble ("0.0");
+    expectDouble ("-0.0");
+    expectDouble ("1e2");
+    expectDouble ("1.5");
+    expectDouble ("-3.14159265358979323846");
+    expectDouble ("6.02214076e+23");
+    expectDouble ("2.2250738585072011e-308");
+    expectDouble ("-9223372036854775809");
+    expectDouble ("18446744073709551616");
+    expectDouble ("18446744073709551620");
+    expectDouble ("123456789012345678901");
+    expectDouble ("123456789012345678901234567890");
+    expectDouble ("inf");
+    expectDouble ("-Infinity");
+    expectDouble ("nan");
+}
+
+/**
+ * @brief invalid test.
+ */
+TEST (number, invalid)
+{
+    for (const std::string str : {"", "-", "+1", "01", "1.", ".5", "1e", "1e+", "infinit", "na"})
+    {
+        dconv::Number number;
+        dconv::View view (str.data (), str.size ());
+
+        EXPECT_FALSE (dconv::parseNumber (view, number)) << str;
+        EXPECT_EQ (view.data (), str.data ()) << str;
+    }
+
+    dconv::Number number;
+    EXPECT_EQ (dconv::parseNumber (nullptr, nullptr, number), nullptr);
+}
+
+/**
+ * @brief random test.
+ */
+TEST (number, random)
+{
+    std::mt19937_64 rng (42);
+    dconv::Number number;
+    char buffer[32];
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t u = rng () >> (rng () % 64);
+        std::string str = std::to_string (u);
+
+        ASSERT_EQ (dconv::parseNumber (str.data (), str.data () + str.size (), number), str.data () + str.size ()) << str;
+        if (u > static_cast <uint64_t> (std::numeric_limits <int64_t>::max ()))
+        {
+            ASSERT_EQ (number._type, dconv::NumberUInt64) << str;
+            ASSERT_EQ (number._uint64, u) << str;
+        }
+        else
+        {
+            ASSERT_EQ (number._type, dconv::NumberInt64) << str;
+            ASSERT_EQ (number._int64, static_cast <int64_t> (u)) << str;
+        }
+
+        const int64_t s = static_cast <int64_t> (rng ()) >> (rng () % 64);
+        str = std::to_string (s);
+
+        ASSERT_NE (dconv::parseNumber (str.data (), str.data () + str.size (), number), nullptr) << str;
+        ASSERT_EQ (number._type, dconv::NumberInt64) << str;
+        ASSERT_EQ (number._int64, s) << str;
+
+        double d;
+        do
+        {
+            const uint64_t bits = rng ();
+            std::memcpy (&d, &bits, sizeof (d));
+        }
+        while (!std::isfinite (d));
+
+        char* end = dconv::dtoa (buffer, d);
+        *end = '\0';
+
+        // integral values may be printed without fraction nor exponent.
+        ASSERT_EQ (dconv::parseNumber (buffer, end, number), end) << buffer;
+        if (number._type == dconv::NumberInt64)
+        {
+            ASSERT_EQ (static_cast <double> (number._int64), d) << buffer;
+        }
+        else
+        {
+            ASSERT_EQ (number._type, dconv::NumberDouble) << buffer;
+            ASSERT_EQ (number._double, d) << buffer;
+        }
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -29,6 +29,9 @@
 // libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <random>
+
 /**
  * @brief round trip test.
  */
@@ -78,6 +81,55 @@ TEST (dconv, roundtrip)
     EXPECT_STREQ (std::string (beg, end - beg).c_str (), "1.7976931348623157e308");
 }
 
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+/**
+ * @brief long double round trip test.
+ */
+TEST (dconv, roundtripLongDouble)
+{
+    using Format = dconv::details::Wide <long double>;
+    std::mt19937_64 gen (0);
+    char beg [48] = {};
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        __uint128_t mantissa = (static_cast <__uint128_t> (gen ()) << 64) | gen ();
+        int exponent = static_cast <int> (gen () % Format::_maxExponent);
+        long double value = Format::fromBits (gen () & 1, exponent, exponent ? (mantissa | Format::_hiddenBit) : (mantissa & (Format::_hiddenBit - 1)));
+        long double result = 0.0L;
+        char* end = dconv::dtoa (beg, value);
+        ASSERT_NE (end, nullptr);
+        *end = '\0';
+        ASSERT_EQ (dconv::atod (beg, result), end);
+        ASSERT_EQ (result, value) << std::string (beg, end - beg);
+    }
+}
+#endif
+
+#if defined(DCONV_HAS_FLOAT128)
+/**
+ * @brief __float128 round trip test.
+ */
+TEST (dconv, roundtripFloat128)
+{
+    using Format = dconv::details::Wide <__float128>;
+    std::mt19937_64 gen (0);
+    char beg [48] = {};
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        __uint128_t mantissa = (static_cast <__uint128_t> (gen ()) << 64) | gen ();
+        __float128 value = Format::fromBits (gen () & 1, static_cast <int> (gen () % Format::_maxExponent), mantissa);
+        __float128 result = 0;
+        char* end = dconv::dtoa (beg, value);
+        ASSERT_NE (end, nullptr);
+        *end = '\0';
+        ASSERT_EQ (dconv::atod (beg, result), end);
+        ASSERT_EQ (Format::toBits (result), Format::toBits (value)) << std::string (beg, end - beg);
+    }
+}
+#endif
+
 /**
  * @brief main function.
  */
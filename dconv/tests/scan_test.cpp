@@ -0,0 +1,231 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/scan.hpp>
+#include <dconv/dtoa.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+#include <cmath>
+
+// C.
+#include <cctype>
+#include <cstring>
+
+/**
+ * @brief scan a number.
+ * @param str string to scan.
+ * @param kind expected kind.
+ * @param length expected length.
+ * @param digits expected number of digits.
+ */
+static void expectScan (const std::string& str, dconv::NumberKind kind, size_t length, size_t digits)
+{
+    dconv::View view (str.data (), str.size ());
+    dconv::NumberToken token = dconv::scan (view);
+
+    EXPECT_EQ (token._kind, kind) << str;
+    EXPECT_EQ (token._first, str.data ()) << str;
+    EXPECT_EQ (token._last, str.data () + length) << str;
+    EXPECT_EQ (token._digits, digits) << str;
+    EXPECT_EQ (view.data (), str.data () + length) << str;
+}
+
+/**
+ * @brief scan test.
+ */
+TEST (scan, scan)
+{
+    expectScan ("", dconv::NumberInvalid, 0, 0);
+    expectScan ("-", dconv::NumberInvalid, 0, 0);
+    expectScan ("+1", dconv::NumberInvalid, 0, 0);
+    expectScan ("01", dconv::NumberInvalid, 0, 0);
+    expectScan ("1.", dconv::NumberInvalid, 0, 0);
+    expectScan (".5", dconv::NumberInvalid, 0, 0);
+    expectScan ("1e", dconv::NumberInvalid, 0, 0);
+    expectScan ("1e+", dconv::NumberInvalid, 0, 0);
+    expectScan ("infinit", dconv::NumberInvalid, 0, 0);
+    expectScan ("na", dconv::NumberInvalid, 0, 0);
+
+    expectScan ("0", dconv::NumberInteger, 1, 1);
+    expectScan ("-0,", dconv::NumberInteger, 2, 1);
+    expectScan ("12345678901234567890123456789,1", dconv::NumberInteger, 29, 29);
+    expectScan ("0.5]", dconv::NumberDecimal, 3, 2);
+    expectScan ("-3.14159265358979323846 ", dconv::NumberDecimal, 23, 21);
+    expectScan ("1e5", dconv::NumberExponent, 3, 1);
+    expectScan ("-1.25E-300x", dconv::NumberExponent, 10, 3);
+    expectScan ("6.02214076e+23", dconv::NumberExponent, 14, 9);
+    expectScan ("inf", dconv::NumberSpecial, 3, 0);
+    expectScan ("-Infinity", dconv::NumberSpecial, 9, 0);
+    expectScan ("NaN,", dconv::NumberSpecial, 3, 0);
+}
+
+/**
+ * @brief scan random test.
+ */
+TEST (scan, random)
+{
+    std::mt19937_64 gen (42);
+    char buffer [64];
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        char* end = dconv::dtoa (buffer, value);
+        *end++ = ',';
+
+        dconv::View view (buffer, end);
+        dconv::NumberToken token = dconv::scan (view);
+        ASSERT_NE (token._kind, dconv::NumberInvalid) << buffer;
+        ASSERT_EQ (token._last, end - 1) << buffer;
+
+        double expected;
+        ASSERT_EQ (dconv::atod (buffer, end, expected), token._last) << buffer;
+    }
+}
+
+/**
+ * @brief LazyNumber test.
+ */
+TEST (scan, lazyNumber)
+{
+    dconv::LazyNumber invalid;
+    EXPECT_FALSE (invalid.valid ());
+    EXPECT_TRUE (std::isnan (invalid.value ()));
+
+    const std::string str ("-1.25e2,0.1,nan");
+    dconv::View view (str.data (), str.size ());
+
+    dconv::LazyNumber first (view);
+    ASSERT_TRUE (first.valid ());
+    EXPECT_EQ (first.token ()._kind, dconv::NumberExponent);
+    EXPECT_EQ (first.value (), -125.0);
+    EXPECT_EQ (first.value (), -125.0);
+
+    ASSERT_TRUE (view.getIf (','));
+    dconv::LazyNumber second (view);
+    ASSERT_TRUE (second.valid ());
+    EXPECT_EQ (second.value (), 0.1);
+
+    ASSERT_TRUE (view.getIf (','));
+    dconv::LazyNumber third (dconv::scan (view));
+    ASSERT_TRUE (third.valid ());
+    EXPECT_EQ (third.token ()._kind, dconv::NumberSpecial);
+    EXPECT_TRUE (std::isnan (third.value ()));
+    EXPECT_EQ (view.size (), 0);
+}
+
+/**
+ * @brief split a number the way an external tokenizer would.
+ * @param str number to split.
+ * @return number spans.
+ */
+static dconv::NumberSpans split (const std::string& str)
+{
+    dconv::NumberSpans spans = {};
+    const char* pos = str.data ();
+    const char* end = pos + str.size ();
+
+    spans._negative = (*pos == '-');
+    pos += spans._negative;
+
+    spans._integer = pos;
+    while ((pos < end) && std::isdigit (*pos)) ++pos;
+    spans._integerLength = pos - spans._integer;
+
+    if ((pos < end) && (*pos == '.'))
+    {
+        spans._fraction = ++pos;
+        while ((pos < end) && std::isdigit (*pos)) ++pos;
+        spans._fractionLength = pos - spans._fraction;
+    }
+
+    if ((pos < end) && ((*pos | 32) == 'e'))
+    {
+        spans._exponent = std::stoll (std::string (pos + 1, end));
+    }
+
+    return spans;
+}
+
+/**
+ * @brief convert number spans.
+ * @param str number to convert.
+ */
+static void expectSpans (const std::string& str)
+{
+    double expected, value;
+
+    ASSERT_NE (dconv::atod (str.c_str (), expected), nullptr) << str;
+    ASSERT_TRUE (dconv::atod (split (str), value)) << str;
+    EXPECT_EQ (value, expected) << str;
+    EXPECT_EQ (std::signbit (value), std::signbit (expected)) << str;
+}
+
+/**
+ * @brief number spans test.
+ */
+TEST (scan, spans)
+{
+    for (const std::string str : {"0", "-0", "1", "0.5", "-0.0000123", "123456789", "12345678.87654321", "1e22", "1e23",
+                                  "6.02214076e+23", "2.2250738585072011e-308", "4.9406564584124654e-324", "1e-400", "1e400",
+                                  "1.7976931348623157e308", "9007199254740993", "9007199254740993.0000000000000000000001",
+                                  "0.000000000000000000000000000000000000000000000000001234567890123456789012345678901e60",
+                                  "123456789012345678901234567890", "18446744073709551615", "0.0001"})
+    {
+        expectSpans (str);
+    }
+
+    std::mt19937_64 gen (42);
+    char buffer [32];
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        if (!std::isfinite (value))
+        {
+            continue;
+        }
+
+        expectSpans (std::string (buffer, dconv::dtoa (buffer, value)));
+        expectSpans (std::to_string (gen ()) + "." + std::to_string (gen ()) + "e" + std::to_string (static_cast <int> (gen () % 600) - 300));
+    }
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
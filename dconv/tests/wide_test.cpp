@@ -0,0 +1,165 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <string>
+
+/**
+ * @brief widen an ASCII string.
+ * @param str string to widen.
+ * @return widened string.
+ */
+template <typename CharT>
+static std::basic_string <CharT> widen (const std::string& str)
+{
+    return std::basic_string <CharT> (str.begin (), str.end ());
+}
+
+/**
+ * @brief wide character test fixture.
+ */
+template <typename CharT>
+class WideTest : public ::testing::Test
+{
+};
+
+using CharTypes = ::testing::Types <char16_t, char32_t, wchar_t>;
+TYPED_TEST_SUITE (WideTest, CharTypes);
+
+/**
+ * @brief wide string to double test.
+ */
+TYPED_TEST (WideTest, atod)
+{
+    using String = std::basic_string <TypeParam>;
+
+    for (const char* str : {"0", "-0.0", "1.5", "-2e3", "0.000123", "1.7976931348623157e308", "5e-324", "inf", "-Infinity", "nan",
+        "123456789012345678901234567890", "0.1234567890123456789012345e-20", "1e400", "12.5xyz"})
+    {
+        double expected = 0.0, value = 0.0;
+        const char* end = dconv::atod (str, expected);
+        ASSERT_NE (end, nullptr) << str;
+
+        String wide = widen <TypeParam> (str);
+        EXPECT_EQ (dconv::atod (wide.c_str (), value), wide.c_str () + (end - str)) << str;
+        EXPECT_EQ (memcmp (&value, &expected, sizeof (double)), 0) << str;
+
+        value = 0.0;
+        EXPECT_EQ (dconv::atod (wide.data (), wide.size (), value), wide.data () + (end - str)) << str;
+        EXPECT_EQ (memcmp (&value, &expected, sizeof (double)), 0) << str;
+
+        value = 0.0;
+        EXPECT_EQ (dconv::atod (wide.data (), wide.data () + wide.size (), value), wide.data () + (end - str)) << str;
+        EXPECT_EQ (memcmp (&value, &expected, sizeof (double)), 0) << str;
+    }
+
+    // code units whose low byte is an ASCII digit, sign, dot or letter must not be taken for one.
+    double value = 0.0;
+    const TypeParam digit[] = {TypeParam (0x0131), 0};
+    EXPECT_EQ (dconv::atod (digit, value), nullptr);
+
+    const TypeParam trailing[] = {'1', TypeParam (0x0132), 0};
+    EXPECT_EQ (dconv::atod (trailing, value), trailing + 1);
+    EXPECT_EQ (value, 1.0);
+
+    const TypeParam exponent[] = {'1', TypeParam (0x0165), '2', 0};
+    EXPECT_EQ (dconv::atod (exponent, value), exponent + 1);
+
+    const TypeParam infinity[] = {TypeParam (0x0149), 'n', 'f', 0};
+    EXPECT_EQ (dconv::atod (infinity, value), nullptr);
+
+    const TypeParam slow[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '0', '1',
+        TypeParam (0x012E), '5', 0};
+    EXPECT_EQ (dconv::atod (slow, value), slow + 21);
+    EXPECT_EQ (value, 123456789012345678901.0);
+}
+
+/**
+ * @brief double to wide string test.
+ */
+TYPED_TEST (WideTest, dtoa)
+{
+    std::mt19937_64 rng;
+    char narrow[32];
+    TypeParam wide[32];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        uint64_t bits = rng ();
+        double value;
+        memcpy (&value, &bits, sizeof (double));
+
+        char* last = dconv::dtoa (narrow, value);
+        TypeParam* end = dconv::dtoa (wide, value);
+        ASSERT_EQ (std::basic_string <TypeParam> (wide, end), widen <TypeParam> (std::string (narrow, last)));
+
+        double result = 0.0;
+        *end = 0;
+        ASSERT_EQ (dconv::atod (wide, result), end);
+
+        if (value == value)
+        {
+            EXPECT_EQ (memcmp (&value, &result, sizeof (double)), 0) << narrow;
+        }
+    }
+
+    TypeParam* end = dconv::dtoa (wide, -0.0);
+    EXPECT_EQ (std::basic_string <TypeParam> (wide, end), widen <TypeParam> ("-0.0"));
+}
+
+#if defined(DCONV_HAS_WIDE_LONG_DOUBLE)
+/**
+ * @brief long double wide conversions test.
+ */
+TYPED_TEST (WideTest, longDouble)
+{
+    char narrow[48];
+    TypeParam wide[48];
+
+    for (long double value : {0.1L, -1.18973149535723176502e+4932L, 3.36210314311209350626e-4932L, 1e-10L})
+    {
+        char* last = dconv::dtoa (narrow, value);
+        TypeParam* end = dconv::dtoa (wide, value);
+        ASSERT_EQ (std::basic_string <TypeParam> (wide, end), widen <TypeParam> (std::string (narrow, last)));
+
+        long double result = 0.0L;
+        ASSERT_EQ (dconv::atod (wide, end, result), end);
+        EXPECT_EQ (result, value);
+    }
+}
+#endif
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,266 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// dconv.
+#include <dconv/writer.hpp>
+
+// libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <limits>
+#include <random>
+#include <string>
+
+// C.
+#include <unistd.h>
+
+/**
+ * @brief counting allocator.
+ */
+template <typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator () noexcept = default;
+
+    template <typename U>
+    CountingAllocator (const CountingAllocator <U>&) noexcept
+    {
+    }
+
+    T* allocate (size_t n)
+    {
+        ++allocations;
+        return std::allocator <T> ().allocate (n);
+    }
+
+    void deallocate (T* p, size_t n) noexcept
+    {
+        std::allocator <T> ().deallocate (p, n);
+    }
+
+    static size_t allocations;
+};
+
+template <typename T>
+size_t CountingAllocator <T>::allocations = 0;
+
+template <typename T, typename U>
+bool operator== (const CountingAllocator <T>&, const CountingAllocator <U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!= (const CountingAllocator <T>&, const CountingAllocator <U>&) noexcept
+{
+    return false;
+}
+
+/**
+ * @brief get the string representation of a double.
+ * @param value value to convert.
+ * @return string representation.
+ */
+static std::string toString (double value)
+{
+    char buffer[32];
+    return std::string (buffer, dconv::dtoa (buffer, value) - buffer);
+}
+
+/**
+ * @brief string sink test.
+ */
+TEST (writer, string)
+{
+    std::string str = "values:";
+    std::string expected = str;
+
+    {
+        dconv::StringSink <> sink (str);
+        dconv::Writer <dconv::StringSink <>> writer (sink);
+        std::mt19937_64 rng;
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            uint64_t bits = rng ();
+            double value;
+            memcpy (&value, &bits, sizeof (double));
+            writer.write (value).put (' ');
+            expected += toString (value) + " ";
+        }
+
+        writer.write (-std::numeric_limits <double>::max ()).put (',').write (123456, 3).write ("end", 3);
+        expected += "-1.7976931348623157e308,123.456end";
+        EXPECT_TRUE (writer.flush ());
+    }
+
+    EXPECT_EQ (str, expected);
+}
+
+/**
+ * @brief allocator aware string sink test.
+ */
+TEST (writer, allocator)
+{
+    using String = std::basic_string <char, std::char_traits <char>, CountingAllocator <char>>;
+    String str;
+
+    {
+        dconv::StringSink <String> sink (str);
+        dconv::Writer <dconv::StringSink <String>> writer (sink);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            writer.write (0.1 * i).put (',');
+        }
+    }
+
+    EXPECT_GT (CountingAllocator <char>::allocations, 0);
+    EXPECT_LT (CountingAllocator <char>::allocations, 20);
+    EXPECT_EQ (str.substr (0, 32), "0.0,0.1,0.2,0.30000000000000004,");
+}
+
+/**
+ * @brief array sink test.
+ */
+TEST (writer, array)
+{
+    char buffer[48];
+    dconv::ArraySink sink (buffer);
+
+    {
+        dconv::Writer <dconv::ArraySink> writer (sink);
+        writer.write (1.5).put (';').write (-2.25);
+        EXPECT_TRUE (writer.flush ());
+    }
+
+    EXPECT_EQ (std::string (sink.data (), sink.size ()), "1.5;-2.25");
+
+    {
+        dconv::Writer <dconv::ArraySink> writer (sink);
+        writer.put (';').write (std::numeric_limits <double>::min ());
+        EXPECT_TRUE (writer.good ());
+        writer.put (';').write (std::numeric_limits <double>::min ());
+        EXPECT_FALSE (writer.good ());
+        EXPECT_FALSE (writer.flush ());
+    }
+
+    EXPECT_EQ (std::string (sink.data (), sink.size ()), "1.5;-2.25;2.2250738585072014e-308;");
+}
+
+/**
+ * @brief integer writer test.
+ */
+TEST (writer, integer)
+{
+    std::string str;
+
+    {
+        dconv::StringSink <> sink (str);
+        dconv::Writer <dconv::StringSink <>> writer (sink);
+        writer.write (0).put (',').write (-42).put (',').write (7u).put (',').write (-3L).put (',');
+        writer.write (std::numeric_limits <int64_t>::min ()).put (',').write (std::numeric_limits <uint64_t>::max ()).put (',');
+        writer.write (static_cast <short> (-12)).put (',').write (static_cast <unsigned char> (200)).put (',').write (0.5);
+    }
+
+    EXPECT_EQ (str, "0,-42,7,-3,-9223372036854775808,18446744073709551615,-12,200,0.5");
+}
+
+/**
+ * @brief fixed point writer test.
+ */
+TEST (writer, fixed)
+{
+    std::string str, expected;
+
+    {
+        dconv::StringSink <> sink (str);
+        dconv::Writer <dconv::StringSink <>> writer (sink);
+        char buffer[64];
+
+        for (int64_t value : {std::numeric_limits <int64_t>::min (), std::numeric_limits <int64_t>::max (), int64_t (-1), int64_t (0)})
+        {
+            for (int scale = -30; scale <= 30; ++scale)
+            {
+                writer.write (value, scale, dconv::FixedTrimZeros);
+                expected.append (buffer, dconv::fixedtoa (buffer, value, scale, dconv::FixedTrimZeros) - buffer);
+            }
+        }
+    }
+
+    EXPECT_EQ (str, expected);
+}
+
+/**
+ * @brief file descriptor sink test.
+ */
+TEST (writer, fd)
+{
+    int fds[2];
+    ASSERT_EQ (pipe (fds), 0);
+
+    std::string expected;
+
+    {
+        dconv::FdSink sink (fds[1], 64);
+        dconv::Writer <dconv::FdSink> writer (sink);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            writer.write (i / 8.0).put ('\n');
+            expected += toString (i / 8.0) + "\n";
+        }
+
+        EXPECT_TRUE (writer.flush ());
+    }
+
+    close (fds[1]);
+
+    std::string result;
+    char buffer[256];
+    ssize_t count;
+
+    while ((count = read (fds[0], buffer, sizeof (buffer))) > 0)
+    {
+        result.append (buffer, count);
+    }
+
+    close (fds[0]);
+
+    EXPECT_EQ (result, expected);
+
+    dconv::FdSink bad (-1);
+    dconv::Writer <dconv::FdSink> writer (bad);
+    writer.write (1.0);
+    EXPECT_FALSE (writer.flush ());
+}
+
+int main (int argc, char **argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,222 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __BENCH_PERF_HPP__
+#define __BENCH_PERF_HPP__
+
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief hardware counters read around a measured run.
+ *
+ * counters are opened as a group so that they are scheduled together, a counter that
+ * can't be opened (containers, virtual machines, perf_event_paranoid) is left unavailable.
+ */
+class PerfCounters
+{
+public:
+    /**
+     * @brief counted events.
+     */
+    enum Event
+    {
+        Cycles,             /**< CPU cycles. */
+        Instructions,       /**< retired instructions. */
+        BranchMisses,       /**< mispredicted branches. */
+        L1DMisses,          /**< L1 data cache read misses. */
+        EventCount,         /**< number of events. */
+    };
+
+    /**
+     * @brief open the counters.
+     */
+    PerfCounters ()
+    {
+        std::memset (_values, 0, sizeof (_values));
+
+        for (int event = 0; event < EventCount; ++event)
+        {
+            _fds[event] = -1;
+        }
+
+    #if defined(__linux__)
+        _fds[Cycles] = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+        _error = (_fds[Cycles] == -1) ? errno : 0;
+
+        if (_fds[Cycles] != -1)
+        {
+            _fds[Instructions] = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, _fds[Cycles]);
+            _fds[BranchMisses] = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, _fds[Cycles]);
+            _fds[L1DMisses] = open (PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), _fds[Cycles]);
+        }
+    #endif
+    }
+
+    /**
+     * @brief close the counters.
+     */
+    ~PerfCounters ()
+    {
+    #if defined(__linux__)
+        for (int event = EventCount - 1; event >= 0; --event)
+        {
+            if (_fds[event] != -1)
+            {
+                close (_fds[event]);
+            }
+        }
+    #endif
+    }
+
+    PerfCounters (const PerfCounters&) = delete;
+    PerfCounters& operator= (const PerfCounters&) = delete;
+
+    /**
+     * @brief check if the counters are available.
+     * @return true if at least the cycles are counted.
+     */
+    bool available () const
+    {
+        return _fds[Cycles] != -1;
+    }
+
+    /**
+     * @brief check if an event is counted.
+     * @param event event to check.
+     * @return true if the event is counted.
+     */
+    bool available (Event event) const
+    {
+        return _fds[event] != -1;
+    }
+
+    /**
+     * @brief get the reason why the counters are unavailable.
+     * @return error number.
+     */
+    int error () const
+    {
+        return _error;
+    }
+
+    /**
+     * @brief reset and start counting.
+     */
+    void start ()
+    {
+    #if defined(__linux__)
+        if (available ())
+        {
+            ioctl (_fds[Cycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl (_fds[Cycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    #endif
+    }
+
+    /**
+     * @brief stop counting and read the counters.
+     */
+    void stop ()
+    {
+    #if defined(__linux__)
+        if (available ())
+        {
+            ioctl (_fds[Cycles], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            for (int event = 0; event < EventCount; ++event)
+            {
+                _values[event] = 0;
+
+                if (_fds[event] != -1)
+                {
+                    uint64_t value[3] = {0, 0, 0};
+
+                    if (read (_fds[event], value, sizeof (value)) == static_cast <ssize_t> (sizeof (value)))
+                    {
+                        // scale the counter if it was multiplexed.
+                        _values[event] = (value[2] && (value[2] < value[1])) ? static_cast <uint64_t> (static_cast <double> (value[0]) * value[1] / value[2]) : value[0];
+                    }
+                }
+            }
+        }
+    #endif
+    }
+
+    /**
+     * @brief get the last counted value of an event.
+     * @param event event to get.
+     * @return counted value.
+     */
+    uint64_t value (Event event) const
+    {
+        return _values[event];
+    }
+
+private:
+#if defined(__linux__)
+    /**
+     * @brief open a counter for the calling thread.
+     * @param type event type.
+     * @param config event configuration.
+     * @param group group leader or -1.
+     * @return file descriptor on success, -1 on failure.
+     */
+    static int open (uint32_t type, uint64_t config, int group)
+    {
+        struct perf_event_attr attr;
+        std::memset (&attr, 0, sizeof (attr));
+
+        attr.size = sizeof (attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = (group == -1);
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        return static_cast <int> (syscall (SYS_perf_event_open, &attr, 0, -1, group, 0));
+    }
+#endif
+
+    /// counters file descriptors.
+    int _fds[EventCount];
+
+    /// last counted values.
+    uint64_t _values[EventCount];
+
+    /// error number of the cycles counter opening.
+    int _error = ENOSYS;
+};
+
+#endif
@@ -0,0 +1,384 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "perf.hpp"
+
+#include <dconv/atod.hpp>
+#include <dconv/dtoa.hpp>
+
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <getopt.h>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+/**
+ * @brief digits generated by grisu2.
+ */
+struct Digits
+{
+    char digits[20];
+    int length;
+    int k;
+};
+
+/// prevent the measured loops from being optimized out.
+static volatile uint64_t sink = 0;
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : usage
+// =========================================================================
+void usage ()
+{
+    std::cout << "Usage" << std::endl;
+    std::cout << "  bench [options]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options" << std::endl;
+    std::cout << "  -h                show available options" << std::endl;
+    std::cout << "  -n runs           number of runs, the fastest is kept (default: 10)" << std::endl;
+    std::cout << "  -p                read hardware counters around each run" << std::endl;
+    std::cout << "  -s size           number of values per corpus (default: 100000)" << std::endl;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : randomDouble
+// =========================================================================
+double randomDouble (std::mt19937_64& rng)
+{
+    double value;
+
+    do
+    {
+        const uint64_t bits = rng ();
+        std::memcpy (&value, &bits, sizeof (value));
+    }
+    while (!std::isfinite (value));
+
+    return value;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : exactCorpus
+// =========================================================================
+std::vector <std::string> exactCorpus (std::mt19937_64& rng, size_t size)
+{
+    // up to 15 digits and a power of ten below 10^22, converted by a single exact operation.
+    std::vector <std::string> corpus;
+    char buffer[64];
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const int digits = 1 + rng () % 15;
+        const int scale = rng () % (digits + 1);
+        const uint64_t significand = rng () % static_cast <uint64_t> (std::pow (10.0, digits));
+        std::snprintf (buffer, sizeof (buffer), "%.*f", scale, significand / std::pow (10.0, scale));
+        corpus.emplace_back (buffer);
+    }
+
+    return corpus;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : eiselLemireCorpus
+// =========================================================================
+std::vector <std::string> eiselLemireCorpus (std::mt19937_64& rng, size_t size)
+{
+    // shortest representation of random doubles, mostly 16 or 17 digits over the whole exponent range.
+    std::vector <std::string> corpus;
+    char buffer[32];
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        corpus.emplace_back (buffer, dconv::dtoa (buffer, randomDouble (rng)));
+    }
+
+    return corpus;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : slowCorpus
+// =========================================================================
+std::vector <std::string> slowCorpus (std::mt19937_64& rng, size_t size)
+{
+    // halfway points between consecutive doubles, truncated bounds can't agree.
+    std::vector <std::string> corpus;
+    char buffer[64];
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const double value = std::fabs (randomDouble (rng));
+        const long double halfway = (static_cast <long double> (value) + std::nextafter (value, HUGE_VAL)) / 2;
+        std::snprintf (buffer, sizeof (buffer), "%.30Le", halfway);
+        corpus.emplace_back (buffer);
+    }
+
+    return corpus;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : randomLengthCorpus
+// =========================================================================
+std::vector <double> randomLengthCorpus (std::mt19937_64& rng, size_t size)
+{
+    // doubles whose shortest representation has 1 to 17 digits, uniformly.
+    std::vector <double> corpus;
+    char buffer[64];
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        double value;
+        std::snprintf (buffer, sizeof (buffer), "%.*e", static_cast <int> (rng () % 17), randomDouble (rng));
+        dconv::atod (buffer, value);
+        corpus.push_back (value);
+    }
+
+    return corpus;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : run
+// =========================================================================
+void run (const std::string& name, size_t size, int runs, PerfCounters* counters, const std::function <void ()>& func)
+{
+    double best = HUGE_VAL;
+    uint64_t values[PerfCounters::EventCount] = {};
+
+    for (int i = 0; i < runs; ++i)
+    {
+        if (counters)
+        {
+            counters->start ();
+        }
+
+        const auto start = std::chrono::steady_clock::now ();
+        func ();
+        const auto end = std::chrono::steady_clock::now ();
+
+        if (counters)
+        {
+            counters->stop ();
+        }
+
+        const double elapsed = std::chrono::duration <double, std::nano> (end - start).count ();
+
+        // the counters of the fastest run are reported with it.
+        if (elapsed < best)
+        {
+            best = elapsed;
+
+            for (int event = 0; counters && (event < PerfCounters::EventCount); ++event)
+            {
+                values[event] = counters->value (static_cast <PerfCounters::Event> (event));
+            }
+        }
+    }
+
+    std::cout << std::left << std::setw (24) << name << std::right << std::fixed << std::setprecision (2)
+              << std::setw (10) << best / size;
+
+    if (counters)
+    {
+        const double cycles = static_cast <double> (values[PerfCounters::Cycles]);
+        const double instructions = static_cast <double> (values[PerfCounters::Instructions]);
+
+        std::cout << std::setw (10) << cycles / size;
+
+        if (counters->available (PerfCounters::Instructions))
+        {
+            std::cout << std::setw (10) << instructions / size << std::setw (8) << (cycles ? instructions / cycles : 0.0);
+        }
+        else
+        {
+            std::cout << std::setw (10) << "n/a" << std::setw (8) << "n/a";
+        }
+
+        for (PerfCounters::Event event : {PerfCounters::BranchMisses, PerfCounters::L1DMisses})
+        {
+            if (counters->available (event))
+            {
+                std::cout << std::setw (12) << std::setprecision (4) << static_cast <double> (values[event]) / size;
+            }
+            else
+            {
+                std::cout << std::setw (12) << "n/a";
+            }
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : main
+// =========================================================================
+int main (int argc, char* argv[])
+{
+    size_t size = 100000;
+    int runs = 10;
+    bool perf = false;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "hn:ps:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'h':
+                usage ();
+                _exit (EXIT_SUCCESS);
+            case 'n':
+                runs = std::stoi (optarg);
+                break;
+            case 'p':
+                perf = true;
+                break;
+            case 's':
+                size = std::stoul (optarg);
+                break;
+            default:
+                usage ();
+                _exit (EXIT_FAILURE);
+        }
+    }
+
+    if ((runs < 1) || (size < 1))
+    {
+        std::cerr << "runs and size must be greater than zero" << std::endl;
+        _exit (EXIT_FAILURE);
+    }
+
+    PerfCounters counters;
+    PerfCounters* active = nullptr;
+
+    if (perf)
+    {
+        if (counters.available ())
+        {
+            active = &counters;
+        }
+        else
+        {
+            std::cerr << "hardware counters unavailable (" << std::strerror (counters.error ()) << "), only timing is reported" << std::endl;
+        }
+    }
+
+    std::mt19937_64 rng (42);
+
+    const std::vector <std::string> exact = exactCorpus (rng, size);
+    const std::vector <std::string> eiselLemire = eiselLemireCorpus (rng, size);
+    const std::vector <std::string> slow = slowCorpus (rng, size);
+
+    std::vector <double> doubles (size);
+    for (double& value : doubles)
+    {
+        value = randomDouble (rng);
+    }
+    const std::vector <double> randomLength = randomLengthCorpus (rng, size);
+
+    std::vector <Digits> digits (size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        dconv::details::grisu2 (digits[i].digits, digits[i].length, digits[i].k, randomLength[i]);
+    }
+
+    std::cout << std::left << std::setw (24) << "benchmark" << std::right << std::setw (10) << "ns/value";
+    if (active)
+    {
+        std::cout << std::setw (10) << "cycles" << std::setw (10) << "instr" << std::setw (8) << "IPC"
+                  << std::setw (12) << "br-miss" << std::setw (12) << "l1d-miss";
+    }
+    std::cout << std::endl;
+
+    auto atod = [] (const std::vector <std::string>& corpus) {
+        return [&corpus] () {
+            double sum = 0;
+            for (const std::string& str : corpus)
+            {
+                double value = 0;
+                dconv::atod (str.data (), str.size (), value);
+                sum += value;
+            }
+            sink = sink + static_cast <uint64_t> (sum != 0);
+        };
+    };
+
+    run ("atod exact pow10", size, runs, active, atod (exact));
+    run ("atod eisel-lemire", size, runs, active, atod (eiselLemire));
+    run ("atod slow path", size, runs, active, atod (slow));
+
+    auto dtoa = [] (const std::vector <double>& corpus) {
+        return [&corpus] () {
+            char buffer[32];
+            uint64_t sum = 0;
+            for (double value : corpus)
+            {
+                sum += dconv::dtoa (buffer, value) - buffer;
+            }
+            sink = sink + sum;
+        };
+    };
+
+    run ("dtoa 17 digits", size, runs, active, dtoa (doubles));
+    run ("dtoa random length", size, runs, active, dtoa (randomLength));
+
+    run ("dtoa digits generation", size, runs, active, [&randomLength] () {
+        char buffer[32];
+        uint64_t sum = 0;
+        for (double value : randomLength)
+        {
+            int length, k;
+            dconv::details::grisu2 (buffer, length, k, value);
+            sum += length + buffer[0];
+        }
+        sink = sink + sum;
+    });
+
+    run ("dtoa formatting", size, runs, active, [&digits] () {
+        char buffer[32];
+        uint64_t sum = 0;
+        for (const Digits& value : digits)
+        {
+            sum += dconv::details::place (buffer, value.digits, value.length, value.k) - buffer;
+        }
+        sink = sink + sum;
+    });
+
+    _exit (EXIT_SUCCESS);
+}
@@ -34,6 +34,7 @@ struct Power
 {
     uint64_t hi;
     uint64_t lo;
+    int exponent = 0;
 };
 
 class BigInt
@@ -125,6 +126,28 @@ public:
         return result;
     }
 
+    int bitLength () const
+    {
+        int msbBlock = static_cast <int> (data.size ()) - 1;
+        uint32_t msbValue = data[msbBlock];
+
+        if (msbValue == 0)
+        {
+            return 0;
+        }
+
+        return msbBlock * 32 + 32 - __builtin_clz (msbValue);
+    }
+
+    bool testBit (int pos) const
+    {
+        if (pos < 0 || pos / 32 >= static_cast <int> (data.size ()))
+        {
+            return false;
+        }
+        return (data[pos / 32] >> (pos % 32)) & 1;
+    }
+
     Power getTop128 () const
     {
         if (data.empty () || (data.size () == 1 && data[0] == 0))
@@ -55,7 +55,10 @@ void usage ()
     std::cout << std::endl;
     std::cout << "Options" << std::endl;
     std::cout << "  -h                show available options" << std::endl;
+    std::cout << "  -e                emit binary exponents" << std::endl;
     std::cout << "  -l lower          lower exponent (default: -325)" << std::endl;
+    std::cout << "  -r                round to nearest instead of truncating" << std::endl;
+    std::cout << "  -s step           exponent step (default: 1)" << std::endl;
     std::cout << "  -u upper          upper exponent (default: 308)" << std::endl;
     std::cout << "  -v                print version" << std::endl;
 }
@@ -64,33 +67,49 @@ void usage ()
 //   CLASS     :
 //   METHOD    : compute
 // =========================================================================
-Power compute (int exponent, int base = 5)
+Power compute (int exponent, bool round = false, int base = 5)
 {
     if (exponent == 0)
     {
-        return { 1ULL << 63, 0 };
+        return { 1ULL << 63, 0, -127 };
     }
 
+    BigInt val (1);
+    int shift = exponent;
+
     if (exponent > 0)
     {
-        BigInt val (1);
         for (int i = 0; i < exponent; ++i)
         {
             val.multiply (base);
         }
-        return val.getTop128 ();
     }
     else
     {
         int absExp = -exponent;
         int bitsNeeded = static_cast <int> (absExp * 2.33) + 128 + 64; 
-        BigInt val = BigInt::powerOfTwo (bitsNeeded);
+        val = BigInt::powerOfTwo (bitsNeeded);
         for (int i = 0; i < absExp; ++i)
         {
             val.divide (base);
         }
-        return val.getTop128 ();
+        shift -= bitsNeeded;
+    }
+
+    int length = val.bitLength ();
+    Power power = val.getTop128 ();
+    power.exponent = length - 128 + shift;
+
+    if (round && val.testBit (length - 129))
+    {
+        if (++power.lo == 0 && ++power.hi == 0)
+        {
+            power.hi = 1ULL << 63;
+            ++power.exponent;
+        }
     }
+
+    return power;
 }
 
 // =========================================================================
@@ -99,19 +118,29 @@ Power compute (int exponent, int base = 5)
 // =========================================================================
 int main (int argc, char* argv[])
 {
-    int minExp = -325, maxExp = 308;
+    int minExp = -325, maxExp = 308, step = 1;
+    bool binary = false, round = false;
 
     int opt;
-    while ((opt = getopt (argc, argv, "hl:u:v")) != -1)
+    while ((opt = getopt (argc, argv, "ehl:rs:u:v")) != -1)
     {
         switch (opt)
         {
+            case 'e':
+                binary = true;
+                break;
             case 'h':
                 usage ();
                 _exit (EXIT_SUCCESS);
             case 'l':
                 minExp = std::stoi (optarg);
                 break;
+            case 'r':
+                round = true;
+                break;
+            case 's':
+                step = std::stoi (optarg);
+                break;
             case 'u':
                 maxExp = std::stoi (optarg);
                 break;
@@ -130,10 +159,16 @@ int main (int argc, char* argv[])
         _exit (EXIT_FAILURE);
     }
 
+    if (step < 1)
+    {
+        std::cerr << "step must be greater than zero" << std::endl;
+        _exit (EXIT_FAILURE);
+    }
+
     std::vector <Power> powers;
-    for (int exp = minExp; exp <= maxExp; ++exp)
+    for (int exp = minExp; exp <= maxExp; exp += step)
     {
-        powers.push_back (compute (exp));
+        powers.push_back (compute (exp, round));
     }
 
     std::cout << "#ifndef __POWER_HPP__" << std::endl;
@@ -145,11 +180,16 @@ int main (int argc, char* argv[])
 
     std::cout << "#define MIN_EXPONENT " << minExp << std::endl;
     std::cout << "#define MAX_EXPONENT " << maxExp << std::endl;
+    std::cout << "#define EXPONENT_STEP " << step << std::endl;
     std::cout << std::endl;
 
     std::cout << "struct Power {" << std::endl;
     std::cout << "    uint64_t hi;" << std::endl;
     std::cout << "    uint64_t lo;" << std::endl;
+    if (binary)
+    {
+        std::cout << "    int exponent;" << std::endl;
+    }
     std::cout << "};" << std::endl;
     std::cout << std::endl;
 
@@ -158,8 +198,13 @@ int main (int argc, char* argv[])
     {
         std::cout << std::hex
                   << "    {0x" << std::setw (16) << std::setfill ('0') << powers[i].hi << ", "
-                  << "0x" << std::setw (16) << std::setfill ('0') << powers[i].lo << "},"
-                  << std::dec << std::endl;
+                  << "0x" << std::setw (16) << std::setfill ('0') << powers[i].lo
+                  << std::dec;
+        if (binary)
+        {
+            std::cout << ", " << powers[i].exponent;
+        }
+        std::cout << "}," << std::endl;
     }
     std::cout << "};" << std::endl;
     std::cout << std::endl;